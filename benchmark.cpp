@@ -0,0 +1,627 @@
+#include "challenge1.hpp"
+#include "challenge10.hpp"
+#include "challenge11.hpp"
+#include "challenge17.hpp"
+#include "challenge2.hpp"
+#include "challenge22.hpp"
+#include "challenge3.hpp"
+#include "challenge4.hpp"
+#include "challenge5.hpp"
+#include "challenge6.hpp"
+#include "challenge7.hpp"
+#include "challenge8.hpp"
+#include "challenge9.hpp"
+#include "gridsearch.hpp"
+#include "helper.hpp"
+#include "inputgenerators.hpp"
+#include "print.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+//Makes the compiler believe the value is used, so the computation is not optimized away.
+template<typename T>
+void keep(const T& value) noexcept {
+    asm volatile("" : : "m"(value) : "memory");
+    return;
+}
+
+struct Options {
+    std::string_view Filter;
+    std::int64_t     Scale = 1;
+};
+
+Options options;
+
+//Runs func until at least MinimumDuration has passed, doubling the iterations each round. Returns ns per iteration.
+template<typename Func>
+double measure(Func&& func) {
+    static constexpr auto MinimumDuration = std::chrono::milliseconds{200};
+
+    for ( std::int64_t iterations = 1;; iterations *= 2 ) {
+        const auto start = Clock::now();
+        for ( std::int64_t i = 0; i < iterations; ++i ) {
+            keep(func());
+        } //for ( std::int64_t i = 0; i < iterations; ++i )
+        const auto duration = Clock::now() - start;
+
+        if ( duration >= MinimumDuration ) {
+            return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) /
+                   static_cast<double>(iterations);
+        } //if ( duration >= MinimumDuration )
+    } //for ( std::int64_t iterations = 1;; iterations *= 2 )
+}
+
+bool selected(std::string_view name) noexcept {
+    return name.contains(options.Filter);
+}
+
+template<typename Func>
+void benchmark(std::string_view name, std::int64_t size, Func&& func) {
+    if ( !selected(name) ) {
+        return;
+    } //if ( !selected(name) )
+
+    const auto nanoSeconds = measure(func);
+    myPrint("{:<40s} {:>10d} {:>14.1f} ns {:>10.2f} ns/item\n", name, size, nanoSeconds,
+            nanoSeconds / static_cast<double>(std::max(size, std::int64_t{1})));
+    return;
+}
+
+//Measures the generic and the specialized variant of a kernel and prints the speedup of the latter.
+template<typename Generic, typename Specialized>
+void compare(std::string_view name, std::int64_t size, Generic&& generic, Specialized&& specialized) {
+    if ( !selected(name) ) {
+        return;
+    } //if ( !selected(name) )
+
+    if ( generic() != specialized() ) {
+        myErr("{:s}: the specialized variant yields a different result!\n", name);
+        return;
+    } //if ( generic() != specialized() )
+
+    const auto genericTime     = measure(generic);
+    const auto specializedTime = measure(specialized);
+    myPrint("{:<40s} {:>10d} {:>14.1f} ns generic {:>14.1f} ns specialized {:>6.2f}x\n", name, size, genericTime,
+            specializedTime, genericTime / specializedTime);
+    return;
+}
+
+void benchmarkHelper(void) {
+    const auto numbers = generateLocationLists(static_cast<std::size_t>(10'000 * options.Scale));
+    benchmark("helper/convert", std::ssize(numbers.lines()), [&numbers](void) {
+        std::int64_t sum = 0;
+        for ( auto line : numbers.lines() ) {
+            sum += convert(line.substr(0, 5));
+        } //for ( auto line : numbers.lines() )
+        return sum;
+    });
+
+    const auto reports = generateReports(static_cast<std::size_t>(10'000 * options.Scale));
+    benchmark("helper/splitString", std::ssize(reports.lines()), [&reports](void) {
+        std::int64_t parts = 0;
+        for ( auto line : reports.lines() ) {
+            parts += std::ranges::distance(splitString(line, ' '));
+        } //for ( auto line : reports.lines() )
+        return parts;
+    });
+
+    const auto side = 100 * options.Scale;
+    benchmark("helper/Coordinate hash", side * side, [side](void) {
+        std::unordered_set<Coordinate<std::int64_t>> set;
+        for ( std::int64_t row = 0; row < side; ++row ) {
+            for ( std::int64_t column = 0; column < side; ++column ) {
+                set.insert({row, column});
+            } //for ( std::int64_t column = 0; column < side; ++column )
+        } //for ( std::int64_t row = 0; row < side; ++row )
+        return set.size();
+    });
+    return;
+}
+
+void benchmarkDay1(void) {
+    const auto                input = generateLocationLists(static_cast<std::size_t>(100'000 * options.Scale));
+    std::vector<std::int64_t> left(input.lines().size());
+    std::vector<std::int64_t> right(input.lines().size());
+    for ( auto&& [l, r, line] : std::views::zip(left, right, input.lines()) ) {
+        day1::parseLine(line, l, r);
+    } //for ( auto&& [l, r, line] : std::views::zip(left, right, input.lines()) )
+
+    //Includes the copy, since the data is sorted in place.
+    compare(
+        "day1/sort", std::ssize(left),
+        [&left](void) {
+            auto copy = left;
+            std::ranges::sort(copy);
+            return copy;
+        },
+        [&left](void) {
+            auto copy = left;
+            day1::radixSort(copy);
+            return copy;
+        });
+
+    std::ranges::sort(left);
+    std::ranges::sort(right);
+    compare(
+        "day1/sumOfDistances", std::ssize(left),
+        [&left, &right](void) {
+            return std::ranges::fold_left(std::views::zip(left, right) | std::views::transform([](auto pair) noexcept {
+                                              return std::abs(std::get<0>(pair) - std::get<1>(pair));
+                                          }),
+                                          std::int64_t{0}, std::plus<>{});
+        },
+        [&left, &right](void) { return day1::sumOfDistances(left, right); });
+
+    //The sorting is only needed for the reference.
+    compare(
+        "day1/similarity", std::ssize(left), [&left, &right](void) { return day1::similarityBySorting(left, right); },
+        [&left, &right](void) { return day1::similarityByCounting(left, right); });
+    return;
+}
+
+void benchmarkDay2(void) {
+    const auto input = generateReports(static_cast<std::size_t>(100'000 * options.Scale));
+    compare(
+        "day2/dampener", std::ssize(input.lines()),
+        [&input](void) {
+            std::int64_t safe = 0;
+            for ( auto line : input.lines() ) {
+                const auto differences = day2::toDifferences(line);
+                if ( day2::isSafe(differences) || day2::isDampenedSafe(differences) ) {
+                    ++safe;
+                } //if ( day2::isSafe(differences) || day2::isDampenedSafe(differences) )
+            } //for ( auto line : input.lines() )
+            return safe;
+        },
+        [&input](void) {
+            return std::ranges::count_if(input.lines(), [](std::string_view line) {
+                return day2::checkReport(line).isDampenedSafe();
+            });
+        });
+    compare(
+        "day2/ReportBatch", std::ssize(input.lines()),
+        [&input](void) {
+            return std::ranges::count_if(input.lines(), [](std::string_view line) {
+                return day2::checkReport(line).isDampenedSafe();
+            });
+        },
+        [&input](void) {
+            day2::ReportBatch batch;
+            std::int64_t      safe = 0;
+            for ( auto line : input.lines() ) {
+                if ( !batch.add(line) ) {
+                    safe += day2::checkReport(line).isDampenedSafe();
+                } //if ( !batch.add(line) )
+                else if ( batch.full() ) {
+                    safe += batch.countSafeWithDampener();
+                    batch.clear();
+                } //else if ( batch.full() )
+            } //for ( auto line : input.lines() )
+            return safe + batch.countSafeWithDampener();
+        });
+    return;
+}
+
+void benchmarkDay3(void) {
+    const auto input = generateCorruptedMemory(static_cast<std::size_t>(4'000'000 * options.Scale));
+    compare(
+        "day3/scanMemory", std::ssize(input.content()),
+        [&input](void) {
+            std::pair<std::int64_t, std::int64_t> sums{};
+            bool                                  enabled = true;
+            for ( auto line : input.lines() ) {
+                sums.first  += day3::findMul(line);
+                sums.second += day3::findMulWithEnabled(line, enabled);
+            } //for ( auto line : input.lines() )
+            return sums;
+        },
+        [&input](void) {
+            day3::ScanState state;
+            for ( auto line : input.lines() ) {
+                day3::scanMemory(line, state);
+            } //for ( auto line : input.lines() )
+            return std::pair{state.Sum, state.EnabledSum};
+        });
+
+    //The whole content as one text, so that it can be split at arbitrary offsets.
+    compare(
+        "day3/scanMemoryParallel", std::ssize(input.content()),
+        [&input](void) {
+            day3::ScanState state;
+            day3::scanMemory(input.content(), state);
+            return std::pair{state.Sum, state.EnabledSum};
+        },
+        [&input](void) {
+            day3::ScanState state;
+            day3::scanMemoryParallel(input.content(), state, std::max(std::thread::hardware_concurrency(), 1u));
+            return std::pair{state.Sum, state.EnabledSum};
+        });
+    return;
+}
+
+void benchmarkDay4(void) {
+    const auto side  = static_cast<std::size_t>(140 * options.Scale);
+    const auto input = generateWordSearch(side, side);
+    compare("day4/countXmas", static_cast<std::int64_t>(side * side),
+            [&input](void) { return day4::countXmas<false>(input.lines()); },
+            [&input](void) { return day4::countXmas<true>(input.lines()); });
+    //Includes building the boards.
+    compare(
+        "day4/LetterBoards countXmas", static_cast<std::int64_t>(side * side),
+        [&input](void) { return day4::countXmas<true>(input.lines()); },
+        [&input](void) { return day4::LetterBoards{input.lines()}.countXmas(); });
+    compare(
+        "day4/LetterBoards countCrossMas", static_cast<std::int64_t>(side * side),
+        [&input](void) { return day4::countCrossMas(input.lines()); },
+        [&input](void) { return day4::LetterBoards{input.lines()}.countCrossMas(); });
+
+    //A dictionary of words with 3 to 8 letters, searched one by one or all at once.
+    const auto                    dictionary = generateWordSearch(250, 8, 1);
+    std::vector<std::string_view> words;
+    for ( std::size_t i = 0; auto line : dictionary.lines() ) {
+        words.push_back(line.substr(0, 3 + i++ % 6));
+    } //for ( std::size_t i = 0; auto line : dictionary.lines() )
+    const GridSearch search{words};
+    compare(
+        "day4/GridSearch dictionary", static_cast<std::int64_t>(side * side),
+        [&input, &words](void) {
+            std::vector<std::int64_t> ret;
+            for ( auto word : words ) {
+                ret.push_back(GridSearch{std::span{&word, 1}}.count(input.lines()).front());
+            } //for ( auto word : words )
+            return ret;
+        },
+        [&input, &search](void) { return search.count(input.lines()); });
+    return;
+}
+
+void benchmarkDay5(void) {
+    const auto input = generatePrintQueue(static_cast<std::size_t>(200 * options.Scale));
+    const auto data  = day5::parse(input.lines());
+    //The updates are copied into the same buffer for both, since the repair works in place.
+    day5::Update buffer;
+    compare(
+        "day5/PrecedenceMatrix", std::ssize(data.Updates),
+        [&data, &buffer](void) {
+            std::pair<std::int64_t, std::int64_t> sums;
+            for ( const auto& update : data.Updates ) {
+                buffer.assign(update.begin(), update.end());
+                if ( day5::isCorrectlyOrdered(data, buffer) ) {
+                    sums.first += day5::midPoint(buffer);
+                } //if ( day5::isCorrectlyOrdered(data, buffer) )
+                else {
+                    sums.second += day5::midPoint(day5::bringToCorrectOrder(data, buffer));
+                } //else -> if ( day5::isCorrectlyOrdered(data, buffer) )
+            } //for ( const auto& update : data.Updates )
+            return sums;
+        },
+        [&data, &buffer](void) {
+            std::pair<std::int64_t, std::int64_t> sums;
+            for ( const auto& update : data.Updates ) {
+                buffer.assign(update.begin(), update.end());
+                if ( data.Precedences.isCorrectlyOrdered(buffer) ) {
+                    sums.first += day5::midPoint(buffer);
+                } //if ( data.Precedences.isCorrectlyOrdered(buffer) )
+                else {
+                    sums.second += data.Precedences.correctedMiddle(buffer);
+                } //else -> if ( data.Precedences.isCorrectlyOrdered(buffer) )
+            } //for ( const auto& update : data.Updates )
+            return sums;
+        });
+
+    //The engine lives across the iterations, like for a stream of updates with fixed rules, so the orders are cached.
+    day5::OrderingEngine engine{data.Precedences};
+    compare(
+        "day5/OrderingEngine", std::ssize(data.Updates),
+        [&data, &buffer](void) {
+            std::pair<std::int64_t, std::int64_t> sums;
+            for ( const auto& update : data.Updates ) {
+                buffer.assign(update.begin(), update.end());
+                if ( day5::isCorrectlyOrdered(data, buffer) ) {
+                    sums.first += day5::midPoint(buffer);
+                } //if ( day5::isCorrectlyOrdered(data, buffer) )
+                else {
+                    sums.second += day5::midPoint(day5::bringToCorrectOrder(data, buffer));
+                } //else -> if ( day5::isCorrectlyOrdered(data, buffer) )
+            } //for ( const auto& update : data.Updates )
+            return sums;
+        },
+        [&data, &engine](void) {
+            std::pair<std::int64_t, std::int64_t> sums;
+            for ( const auto& update : data.Updates ) {
+                if ( engine.isCorrectlyOrdered(update) ) {
+                    sums.first += day5::midPoint(update);
+                } //if ( engine.isCorrectlyOrdered(update) )
+                else {
+                    sums.second += day5::midPoint(engine.correctOrder(update));
+                } //else -> if ( engine.isCorrectlyOrdered(update) )
+            } //for ( const auto& update : data.Updates )
+            return sums;
+        });
+    return;
+}
+
+void benchmarkDay6(void) {
+    const auto side  = static_cast<std::size_t>(130 * options.Scale);
+    const auto input = generatePatrolMap(side, side);
+    const auto start = day6::findStart(input.lines());
+    compare(
+        "day6/PatrolMap countVisited", static_cast<std::int64_t>(side * side),
+        [&input, start](void) { return static_cast<std::int64_t>(day6::moveFromMap(input.lines(), start)); },
+        [&input](void) { return day6::PatrolMap{input.lines()}.countVisited(); });
+    compare(
+        "day6/PatrolMap countLoopObstacles", static_cast<std::int64_t>(side * side),
+        [&input, start](void) { return day6::findObstaclesForLoop(input.lines(), start); },
+        [&input](void) { return day6::PatrolMap{input.lines()}.countLoopObstacles(); });
+
+    const day6::PatrolMap map{input.lines()};
+    compare(
+        "day6/PatrolMap parallel", static_cast<std::int64_t>(side * side),
+        [&map](void) { return map.countLoopObstacles(1); }, [&map](void) { return map.countLoopObstacles(); });
+    return;
+}
+
+void benchmarkDay7(void) {
+    for ( auto operands : {4zu, 8zu, 11zu} ) {
+        const auto input     = generateEquations(static_cast<std::size_t>(100 * options.Scale), operands);
+        const auto equations = day7::parse(input.lines());
+        const auto name      = std::format("day7/isEquationValid({:d})", operands);
+        compare(name, std::ssize(equations),
+                [&equations](void) {
+                    return std::ranges::count_if(equations, day7::isEquationValidGeneric<true>);
+                },
+                [&equations](void) { return std::ranges::count_if(equations, day7::isEquationValid<true>); });
+        compare(std::format("day7/isEquationValidReverse({:d})", operands), std::ssize(equations),
+                [&equations](void) { return std::ranges::count_if(equations, day7::isEquationValid<true>); },
+                [&equations](void) {
+                    return std::ranges::count_if(equations, [](const day7::Equation& equation) noexcept {
+                        return day7::isEquationValidReverse<true>(equation.Result, equation.Operands);
+                    });
+                });
+    } //for ( auto operands : {4zu, 8zu, 11zu} )
+
+    //Both parts, the specialized variant includes the parsing into one buffer.
+    const auto many = generateEquations(static_cast<std::size_t>(100'000 * options.Scale), 8);
+    compare(
+        "day7/sumValidParallel", std::ssize(many.lines()),
+        [&many](void) {
+            std::pair<std::int64_t, std::int64_t> sums;
+            for ( const auto& equation : day7::parse(many.lines()) ) {
+                sums.first  += day7::isEquationValidReverse<false>(equation.Result, equation.Operands)
+                                   ? equation.Result
+                                   : 0;
+                sums.second += day7::isEquationValidReverse<true>(equation.Result, equation.Operands)
+                                   ? equation.Result
+                                   : 0;
+            } //for ( const auto& equation : day7::parse(many.lines()) )
+            return sums;
+        },
+        [&many](void) {
+            const auto sums = day7::sumValidParallel(day7::parseBatch(many.lines()));
+            return std::pair{sums.Total, sums.TotalWithConcatenation};
+        });
+
+    //Out of reach for the forward search.
+    const auto input     = generateEquations(static_cast<std::size_t>(100 * options.Scale), 40);
+    const auto equations = day7::parse(input.lines());
+    benchmark("day7/isEquationValidReverse(40)", std::ssize(equations), [&equations](void) {
+        return std::ranges::count_if(equations, [](const day7::Equation& equation) noexcept {
+            return day7::isEquationValidReverse<true>(equation.Result, equation.Operands);
+        });
+    });
+    return;
+}
+
+void benchmarkDay8(void) {
+    //Like the real map, and with many antennas per frequency.
+    for ( auto [side, antennas, frequencies] : {std::tuple{50, 200, 40}, std::tuple{250, 500, 2}} ) {
+        const auto scaledSide     = static_cast<std::size_t>(side * options.Scale);
+        const auto scaledAntennas = static_cast<std::size_t>(antennas * options.Scale);
+        const auto input          = generateAntennaMap(scaledSide, scaledSide, scaledAntennas,
+                                                       static_cast<std::size_t>(frequencies));
+        const auto size           = static_cast<std::int64_t>(scaledAntennas);
+        compare(
+            std::format("day8/AntennaMap countAntinodes({:d})", frequencies), size,
+            [&input](void) {
+                return static_cast<std::int64_t>(day8::countAntinodes(day8::findAntennas(input.lines())));
+            },
+            [&input](void) { return day8::AntennaMap{input.lines()}.countAntinodes(); });
+        compare(
+            std::format("day8/AntennaMap countResonantAntinodes({:d})", frequencies), size,
+            [&input](void) {
+                return static_cast<std::int64_t>(day8::countResonantAntinodes(day8::findAntennas(input.lines())));
+            },
+            [&input](void) { return day8::AntennaMap{input.lines()}.countResonantAntinodes(); });
+    } //for ( auto [side, antennas, frequencies] : {std::tuple{50, 200, 40}, std::tuple{250, 500, 2}} )
+    return;
+}
+
+void benchmarkDay9(void) {
+    //The file ids have to fit into a FileBlock.
+    const auto digits = static_cast<std::size_t>(std::min<std::int64_t>(20'000 * options.Scale, 65'000));
+    const auto input  = generateDiskMap(digits);
+    const auto blocks = day9::parse(input.lines().front());
+
+    benchmark("day9/parse", static_cast<std::int64_t>(digits),
+              [&input](void) { return day9::parse(input.lines().front()).size(); });
+    //Includes the parsing, which compactBlocks does not need.
+    compare(
+        "day9/compactBlocks", static_cast<std::int64_t>(digits),
+        [&input](void) { return day9::moveFileBlocksAndBuildCheckSum(day9::parse(input.lines().front())); },
+        [&input](void) { return day9::compactBlocks(input.lines().front()); });
+    //Includes the copy, since the blocks are modified.
+    compare(
+        "day9/compactFiles", static_cast<std::int64_t>(digits),
+        [&blocks](void) {
+            auto copy = blocks;
+            return day9::moveFilesAndBuildCheckSum(copy);
+        },
+        [&input](void) { return day9::compactFiles(input.lines().front()); });
+
+    //Far beyond the ids of a FileBlock.
+    const auto large = generateDiskMap(static_cast<std::size_t>(1'000'000 * options.Scale));
+    benchmark("day9/compactBlocks large", std::ssize(large.lines().front()),
+              [&large](void) { return day9::compactBlocks(large.lines().front()); });
+    benchmark("day9/compactFiles large", std::ssize(large.lines().front()),
+              [&large](void) { return day9::compactFiles(large.lines().front()); });
+    return;
+}
+
+void benchmarkDay10(void) {
+    //Like the real map, one summit in about 40 cells.
+    const auto side  = static_cast<std::size_t>(50 * options.Scale);
+    const auto input = generateTopographicMap(side, side, side * side / 40);
+    const auto size  = static_cast<std::int64_t>(side * side);
+    compare(
+        "day10/TrailMap scores", size, [&input](void) { return day10::sumScores(input.lines()); },
+        [&input](void) { return day10::TrailMap{input.lines()}.sum().Scores; });
+    compare(
+        "day10/TrailMap ratings", size, [&input](void) { return day10::sumRatings(input.lines()); },
+        [&input](void) { return day10::TrailMap{input.lines()}.sum().Ratings; });
+
+    const auto largeSide = static_cast<std::size_t>(1'000 * options.Scale);
+    const auto large     = generateTopographicMap(largeSide, largeSide, largeSide * largeSide / 40);
+    benchmark("day10/TrailMap large", static_cast<std::int64_t>(largeSide * largeSide),
+              [&large](void) { return day10::TrailMap{large.lines()}.sum().Scores; });
+    return;
+}
+
+void benchmarkDay11(void) {
+    const auto input  = generateStones(static_cast<std::size_t>(1'000 * options.Scale));
+    const auto stones = splitString(input.lines().front(), ' ') |
+                        std::views::transform([](std::string_view stone) { return convert(stone); }) |
+                        std::ranges::to<std::vector>();
+    benchmark("day11/blink", std::ssize(stones), [&stones](void) {
+        std::int64_t sum = 0;
+        for ( auto value : stones ) {
+            //Blink every stone 5 times, without any caching.
+            std::vector<day11::Stone> current{{value, 5}};
+            std::vector<day11::Stone> next;
+            while ( current.front().TimesToConvert > 0 ) {
+                next.clear();
+                for ( auto stone : current ) {
+                    const auto result = day11::blink(stone);
+                    next.push_back(result.FirstStone);
+                    if ( result.SecondStone.Value != day11::NoStone ) {
+                        next.push_back(result.SecondStone);
+                    } //if ( result.SecondStone.Value != day11::NoStone )
+                } //for ( auto stone : current )
+                std::swap(current, next);
+            } //while ( current.front().TimesToConvert > 0 )
+            sum += std::ssize(current);
+        } //for ( auto value : stones )
+        return sum;
+    });
+
+    compare(
+        "day11/StoneHistogram(75)", std::ssize(stones), [&stones](void) { return day11::countStones(stones, 75); },
+        [&stones](void) {
+            day11::StoneHistogram histogram{stones};
+            histogram.blinkUntil(75);
+            return static_cast<std::int64_t>(histogram.count());
+        });
+    benchmark("day11/StoneHistogram countsAfter(150)", std::ssize(stones), [&stones](void) {
+        day11::StoneHistogram histogram{stones};
+        const auto            counts = histogram.countsAfter(std::array<std::int64_t, 3>{25, 75, 150});
+        return static_cast<std::uint64_t>(counts.back());
+    });
+    return;
+}
+
+void benchmarkDay17(void) {
+    static constexpr std::array program{"Register A: 0"sv, "Register B: 0"sv, "Register C: 0"sv, ""sv,
+                                        "Program: 2,4,1,3,7,5,4,1,1,3,0,3,5,5,3,0"sv};
+    const auto                  count = 10'000 * options.Scale;
+    compare("day17/runForRegisterValues", count,
+            [count](void) { return day17::runForRegisterValues<false>(program, 1 << 20, count); },
+            [count](void) { return day17::runForRegisterValues<true>(program, 1 << 20, count); });
+    return;
+}
+
+void benchmarkDay22(void) {
+    const auto input   = generateSecrets(static_cast<std::size_t>(100 * options.Scale));
+    const auto secrets = input.lines() | std::views::transform([](std::string_view line) { return convert(line); }) |
+                         std::ranges::to<std::vector>();
+    benchmark("day22/generateSecretNumbers", std::ssize(secrets), [&secrets](void) {
+        std::int64_t sum = 0;
+        for ( auto secret : secrets ) {
+            sum += day22::generateSecretNumbers(secret).back();
+        } //for ( auto secret : secrets )
+        return sum;
+    });
+    return;
+}
+} //namespace
+
+/**
+ * @brief Runs the micro benchmarks.
+ * @param[in] argc Die Anzahl der Arguments.
+ * @param[in] argv Die Werte der Argumente: [filter] [--scale N], only benchmarks containing filter are run, N
+ *                 multiplies the input sizes.
+ * @result 0 bei Erfolg.
+ */
+int main(int argc, const char* argv[]) {
+    const std::span arguments{argv + 1, argv + argc};
+    for ( auto iter = arguments.begin(); iter != arguments.end(); ++iter ) {
+        if ( *iter == "--scale"sv ) {
+            if ( std::next(iter) == arguments.end() ) {
+                myErr("--scale needs a value!\n");
+                return -1;
+            } //if ( std::next(iter) == arguments.end() )
+
+            ++iter;
+            const auto scale = convertOptionally(*iter);
+            if ( !scale || *scale < 1 ) {
+                myErr("Invalid scale {:s}!\n", *iter);
+                return -1;
+            } //if ( !scale || *scale < 1 )
+            options.Scale = *scale;
+        } //if ( *iter == "--scale"sv )
+        else {
+            options.Filter = *iter;
+        } //else -> if ( *iter == "--scale"sv )
+    } //for ( auto iter = arguments.begin(); iter != arguments.end(); ++iter )
+
+    try {
+        benchmarkHelper();
+        benchmarkDay1();
+        benchmarkDay2();
+        benchmarkDay3();
+        benchmarkDay4();
+        benchmarkDay5();
+        benchmarkDay6();
+        benchmarkDay7();
+        benchmarkDay8();
+        benchmarkDay9();
+        benchmarkDay10();
+        benchmarkDay11();
+        benchmarkDay17();
+        benchmarkDay22();
+    } //try
+    catch ( const std::exception& e ) {
+        myErr("{:s}\n", e.what());
+        return -2;
+    } //catch ( const std::exception& e )
+    myFlush();
+    return 0;
+}
@@ -1,28 +1,220 @@
 #include "challenge1.hpp"
 
 #include "helper.hpp"
+#include "linereader.hpp"
 #include "print.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <iterator>
+#include <numeric>
 #include <ranges>
 #include <span>
+#include <unordered_map>
+#include <utility>
 
 namespace {
-std::int64_t distance(std::tuple<std::int64_t, std::int64_t> input) noexcept {
-    const auto [left, right] = input;
-    return std::abs(left - right);
-}
-
-std::int64_t dropSame(std::span<std::int64_t>& data) noexcept {
+std::int64_t dropSame(std::span<const std::int64_t>& data) noexcept {
     auto firstDifferent =
         std::ranges::find_if(data, [data](std::int64_t number) noexcept { return number != data.front(); });
     const std::int64_t ret = std::ranges::distance(data.begin(), firstDifferent);
     data                   = {firstDifferent, data.end()};
     return ret;
 }
+
+bool solve(std::vector<std::int64_t>& left, std::vector<std::int64_t>& right) {
+    day1::sortLocations(left);
+    day1::sortLocations(right);
+
+    const auto sum1 = day1::sumOfDistances(left, right);
+    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+
+    const auto sum2 = day1::similarityByCounting(left, right);
+    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+
+    return sum1 == 1765812 && sum2 == 20520794;
+}
 } //namespace
 
+namespace day1 {
+void parseLine(std::string_view line, std::int64_t& left, std::int64_t& right) {
+    auto split = splitString(line, ' ');
+    throwIfInvalid(std::ranges::distance(split) == 2);
+    left  = convert(*split.begin());
+    right = convert(*std::next(split.begin()));
+    return;
+}
+
+void radixSort(std::vector<std::int64_t>& data) {
+    static constexpr std::size_t Bits    = 8;
+    static constexpr std::size_t Buckets = 1 << Bits;
+    static constexpr std::size_t Passes  = 64 / Bits;
+
+    //With the sign bit flipped negative numbers come before the positive ones, when compared unsigned.
+    auto digit = [](std::int64_t value, std::size_t pass) noexcept {
+        return (std::bit_cast<std::uint64_t>(value) ^ (std::uint64_t{1} << 63)) >> (pass * Bits) & (Buckets - 1);
+    };
+
+    std::array<std::array<std::size_t, Buckets>, Passes> counts{};
+    for ( auto value : data ) {
+        for ( std::size_t pass = 0; pass < Passes; ++pass ) {
+            ++counts[pass][digit(value, pass)];
+        } //for ( std::size_t pass = 0; pass < Passes; ++pass )
+    } //for ( auto value : data )
+
+    std::vector<std::int64_t> buffer(data.size());
+    std::span                 source{data};
+    std::span                 target{buffer};
+
+    for ( std::size_t pass = 0; pass < Passes; ++pass ) {
+        auto& offsets = counts[pass];
+        //All numbers share this digit, the pass would not change anything.
+        if ( std::ranges::contains(offsets, data.size()) ) {
+            continue;
+        } //if ( std::ranges::contains(offsets, data.size()) )
+
+        std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), 0zu);
+        for ( auto value : source ) {
+            target[offsets[digit(value, pass)]++] = value;
+        } //for ( auto value : source )
+        std::swap(source, target);
+    } //for ( std::size_t pass = 0; pass < Passes; ++pass )
+
+    if ( source.data() != data.data() ) {
+        std::ranges::copy(source, data.begin());
+    } //if ( source.data() != data.data() )
+    return;
+}
+
+void sortLocations(std::vector<std::int64_t>& data) {
+    if ( data.size() >= RadixSortThreshold ) {
+        radixSort(data);
+    } //if ( data.size() >= RadixSortThreshold )
+    else {
+        std::ranges::sort(data);
+    } //else -> if ( data.size() >= RadixSortThreshold )
+    return;
+}
+
+std::int64_t sumOfDistances(std::span<const std::int64_t> left, std::span<const std::int64_t> right) noexcept {
+    //A plain loop without dependencies between the iterations, so the compiler can vectorize it.
+    const auto   size = std::min(left.size(), right.size());
+    std::int64_t sum  = 0;
+    for ( std::size_t i = 0; i < size; ++i ) {
+        const auto difference  = left[i] - right[i];
+        sum                   += difference < 0 ? -difference : difference;
+    } //for ( std::size_t i = 0; i < size; ++i )
+    return sum;
+}
+
+std::int64_t similarityBySorting(std::span<const std::int64_t> left, std::span<const std::int64_t> right) noexcept {
+    auto calculateSimularity = [rightSpan = right, previousNumber = std::int64_t{0},
+                                previousCount = std::int64_t{0}](std::int64_t number) mutable noexcept {
+        //Equal numbers on the left are adjacent, the right ones are already dropped for the first of them.
+        if ( number != previousNumber ) {
+            previousNumber = number;
+            previousCount  = 0;
+
+            while ( !rightSpan.empty() && rightSpan.front() < number ) {
+                dropSame(rightSpan);
+            } //while ( !rightSpan.empty() && rightSpan.front() < number )
+
+            if ( !rightSpan.empty() && rightSpan.front() == number ) {
+                previousCount = dropSame(rightSpan);
+            } //if ( !rightSpan.empty() && rightSpan.front() == number )
+        } //if ( number != previousNumber )
+        return number * previousCount;
+    };
+
+    auto simularity = left | std::views::transform(calculateSimularity);
+    return std::ranges::fold_left(simularity, std::int64_t{0}, std::plus<>{});
+}
+
+std::int64_t similarityByCounting(std::span<const std::int64_t> left, std::span<const std::int64_t> right) {
+    if ( right.empty() ) {
+        return 0;
+    } //if ( right.empty() )
+
+    const auto [min, max] = std::ranges::minmax(right);
+    //The number of entries of a table is spread + 1, which would wrap for the complete range of int64.
+    const auto spread     = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min);
+
+    //A direct table, if it has at most four entries per input number (but at least 2^16 are always fine), otherwise a
+    //hash map.
+    if ( spread < std::max<std::uint64_t>(right.size() * 4, 1 << 16) ) {
+        std::vector<std::int64_t> counts(spread + 1);
+        for ( auto number : right ) {
+            ++counts[static_cast<std::size_t>(number - min)];
+        } //for ( auto number : right )
+
+        std::int64_t ret = 0;
+        for ( auto number : left ) {
+            if ( number >= min && number <= max ) {
+                ret += number * counts[static_cast<std::size_t>(number - min)];
+            } //if ( number >= min && number <= max )
+        } //for ( auto number : left )
+        return ret;
+    } //if ( spread < std::max<std::uint64_t>(right.size() * 4, 1 << 16) )
+
+    std::unordered_map<std::int64_t, std::int64_t> counts;
+    counts.reserve(right.size());
+    for ( auto number : right ) {
+        ++counts[number];
+    } //for ( auto number : right )
+
+    std::int64_t ret = 0;
+    for ( auto number : left ) {
+        if ( auto iter = counts.find(number); iter != counts.end() ) {
+            ret += number * iter->second;
+        } //if ( auto iter = counts.find(number); iter != counts.end() )
+    } //for ( auto number : left )
+    return ret;
+}
+
+void LocationLists::add(std::int64_t left, std::int64_t right) {
+    auto countOf = [](const auto& counts, std::int64_t number) noexcept -> std::int64_t {
+        const auto iter = counts.find(number);
+        return iter == counts.end() ? 0 : iter->second;
+    };
+
+    //The new left number pairs with all equal right numbers, including the new one. And the new right number with all
+    //the old left numbers.
+    Similarity += left * (countOf(RightCounts, left) + (left == right ? 1 : 0)) + right * countOf(LeftCounts, right);
+    ++LeftCounts[left];
+    ++RightCounts[right];
+
+    Left.push_back(left);
+    Right.push_back(right);
+    return;
+}
+
+std::int64_t LocationLists::distanceSum(void) {
+    if ( Sorted == Left.size() ) {
+        return DistanceSum;
+    } //if ( Sorted == Left.size() )
+
+    //Only the appended numbers are sorted, and then merged into the already sorted ones.
+    auto mergeAppended = [this](std::vector<std::int64_t>& data) {
+        if ( Sorted == 0 ) {
+            sortLocations(data);
+            return;
+        } //if ( Sorted == 0 )
+
+        const auto middle = std::next(data.begin(), static_cast<std::ptrdiff_t>(Sorted));
+        std::ranges::sort(middle, data.end());
+        std::ranges::inplace_merge(data, middle);
+        return;
+    };
+
+    mergeAppended(Left);
+    mergeAppended(Right);
+    Sorted      = Left.size();
+    DistanceSum = sumOfDistances(Left, Right);
+    return DistanceSum;
+}
+} //namespace day1
+
 bool challenge1(const std::vector<std::string_view>& input) {
     std::vector<std::int64_t> left;
     std::vector<std::int64_t> right;
@@ -30,41 +222,24 @@ bool challenge1(const std::vector<std::string_view>& input) {
     right.resize(input.size());
 
     for ( auto&& [l, r, line] : std::views::zip(left, right, input) ) {
-        auto split = splitString(line, ' ');
-        throwIfInvalid(std::ranges::distance(split) == 2);
-        l = convert(*split.begin());
-        r = convert(*std::next(split.begin()));
+        day1::parseLine(line, l, r);
     } //for (auto&& [l, r, line] : std::views::zip(left, right, input))
 
-    std::ranges::sort(left);
-    std::ranges::sort(right);
-
-    auto       distances = std::views::zip(left, right) | std::views::transform(distance);
-    const auto sum1      = std::ranges::fold_left(distances, 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
-
-    auto calculateSimularity = [rightSpan = std::span{right}](std::int64_t number) mutable noexcept -> std::int64_t {
-        if ( rightSpan.empty() ) {
-            return 0;
-        } //if ( rightSpan.empty() )
+    return solve(left, right);
+}
 
-        while ( rightSpan.front() < number ) {
-            dropSame(rightSpan);
-            if ( rightSpan.empty() ) {
-                return 0;
-            } //if ( rightSpan.empty() )
-        } //while ( rightSpan.front() < number )
+bool challenge1Streaming(LineReader& input) {
+    //The sorting needs all numbers, but not the lines.
+    std::vector<std::int64_t> left;
+    std::vector<std::int64_t> right;
 
-        if ( rightSpan.front() > number ) {
-            return 0;
-        } //if ( rightSpan.front() > number )
+    while ( auto line = input.next() ) {
+        if ( line->empty() ) {
+            continue;
+        } //if ( line->empty() )
 
-        return number * dropSame(rightSpan);
-    };
+        day1::parseLine(*line, left.emplace_back(), right.emplace_back());
+    } //while ( auto line = input.next() )
 
-    auto       simularity = left | std::views::transform(calculateSimularity);
-    const auto sum2       = std::ranges::fold_left(simularity, 0, std::plus<>{});
-    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
-
-    return sum1 == 1765812 && sum2 == 20520794;
+    return solve(left, right);
 }
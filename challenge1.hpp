@@ -1,9 +1,53 @@
 #ifndef CHALLENGE1_HPP
 #define CHALLENGE1_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
+class LineReader;
+
 bool challenge1(const std::vector<std::string_view>& input);
+bool challenge1Streaming(LineReader& input);
+
+namespace day1 {
+//From this size on the radix sort beats std::ranges::sort.
+constexpr std::size_t RadixSortThreshold = 16'384;
+
+void         parseLine(std::string_view line, std::int64_t& left, std::int64_t& right);
+//LSD radix sort, linear in the size of data.
+void         radixSort(std::vector<std::int64_t>& data);
+void         sortLocations(std::vector<std::int64_t>& data);
+std::int64_t sumOfDistances(std::span<const std::int64_t> left, std::span<const std::int64_t> right) noexcept;
+//Both lists have to be sorted.
+std::int64_t similarityBySorting(std::span<const std::int64_t> left, std::span<const std::int64_t> right) noexcept;
+//Works on unsorted lists, in linear time.
+std::int64_t similarityByCounting(std::span<const std::int64_t> left, std::span<const std::int64_t> right);
+
+//Keeps the results of both parts up to date, while pairs are added.
+class LocationLists {
+    public:
+    void add(std::int64_t left, std::int64_t right);
+
+    std::int64_t similarity(void) const noexcept {
+        return Similarity;
+    }
+
+    //Only sorts the pairs added since the last call.
+    std::int64_t distanceSum(void);
+
+    private:
+    std::vector<std::int64_t>                      Left;
+    std::vector<std::int64_t>                      Right;
+    std::size_t                                    Sorted = 0;
+    std::unordered_map<std::int64_t, std::int64_t> LeftCounts;
+    std::unordered_map<std::int64_t, std::int64_t> RightCounts;
+    std::int64_t                                   Similarity  = 0;
+    std::int64_t                                   DistanceSum = 0;
+};
+} //namespace day1
 
 #endif //CHALLENGE1_HPP
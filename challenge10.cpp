@@ -4,6 +4,7 @@
 #include "print.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <ranges>
 #include <stack>
 #include <unordered_set>
@@ -72,24 +73,118 @@ auto calcRating(Position startPosition, MapView map) noexcept {
 }
 } //namespace
 
+namespace day10 {
+std::int64_t sumScores(const std::vector<std::string_view>& map) {
+    MapView mapView{map};
+    Position::setMaxFromMap(mapView);
+    std::int64_t ret = 0;
+    for ( auto position : Position::allPositions() ) {
+        if ( mapView[position] == '0' ) {
+            ret += static_cast<std::int64_t>(calcScore(position, mapView));
+        } //if ( mapView[position] == '0' )
+    } //for ( auto position : Position::allPositions() )
+    return ret;
+}
+
+std::int64_t sumRatings(const std::vector<std::string_view>& map) {
+    MapView mapView{map};
+    Position::setMaxFromMap(mapView);
+    std::int64_t ret = 0;
+    for ( auto position : Position::allPositions() ) {
+        if ( mapView[position] == '0' ) {
+            ret += calcRating(position, mapView);
+        } //if ( mapView[position] == '0' )
+    } //for ( auto position : Position::allPositions() )
+    return ret;
+}
+
+TrailMap::TrailMap(const std::vector<std::string_view>& map) :
+        Rows{map.size()}, Columns{map.empty() ? 0 : map.front().size()} {
+    throwIfInvalid(std::ranges::all_of(map, [this](std::string_view row) noexcept { return row.size() == Columns; }));
+    Heights.reserve(Rows * Columns);
+    for ( std::string_view row : map ) {
+        for ( char c : row ) {
+            const auto height = c >= '0' && c <= '9' ? static_cast<std::uint8_t>(c - '0') : NoTrail;
+            if ( height != NoTrail ) {
+                Levels[height].push_back(Heights.size());
+            } //if ( height != NoTrail )
+            Heights.push_back(height);
+        } //for ( char c : row )
+    } //for ( std::string_view row : map )
+    return;
+}
+
+TrailSums TrailMap::sum(void) const {
+    struct Trails {
+        std::uint64_t Summits = 0;
+        std::int64_t  Paths   = 0;
+    };
+
+    TrailSums           ret;
+    std::vector<Trails> trails(Heights.size());
+    const auto&         summits = Levels[Summit];
+    for ( std::size_t chunkBegin = 0; chunkBegin < summits.size(); chunkBegin += 64 ) {
+        const auto chunkEnd  = std::min(chunkBegin + 64, summits.size());
+        const auto firstRow  = summits[chunkBegin] / Columns;
+        const auto lastRow   = summits[chunkEnd - 1] / Columns;
+        const auto beginCell = (firstRow - std::min(firstRow, Summit)) * Columns;
+        const auto endCell   = std::min(lastRow + Summit + 1, Rows) * Columns;
+
+        auto levelInChunk = [this, beginCell, endCell](std::size_t height) noexcept {
+            const auto& level = Levels[height];
+            return std::ranges::subrange{std::ranges::lower_bound(level, beginCell),
+                                         std::ranges::lower_bound(level, endCell)};
+        };
+
+        for ( auto cell : levelInChunk(Summit) ) {
+            trails[cell] = {};
+        } //for ( auto cell : levelInChunk(Summit) )
+        for ( std::size_t summit = chunkBegin; summit < chunkEnd; ++summit ) {
+            trails[summits[summit]] = {std::uint64_t{1} << (summit - chunkBegin), 1};
+        } //for ( std::size_t summit = chunkBegin; summit < chunkEnd; ++summit )
+
+        //Every cell one higher inside the rows of the chunk is already set, the ones outside reach no summit of it.
+        for ( std::size_t height = Summit; height-- > 0; ) {
+            for ( auto cell : levelInChunk(height) ) {
+                Trails sum;
+                auto   add = [this, &trails, &sum, height](std::size_t neighbor) noexcept {
+                    if ( Heights[neighbor] == height + 1 ) {
+                        sum.Summits |= trails[neighbor].Summits;
+                        sum.Paths   += trails[neighbor].Paths;
+                    } //if ( Heights[neighbor] == height + 1 )
+                    return;
+                };
+
+                const auto column = cell % Columns;
+                if ( column > 0 ) {
+                    add(cell - 1);
+                } //if ( column > 0 )
+                if ( column + 1 < Columns ) {
+                    add(cell + 1);
+                } //if ( column + 1 < Columns )
+                if ( cell >= beginCell + Columns ) {
+                    add(cell - Columns);
+                } //if ( cell >= beginCell + Columns )
+                if ( cell + Columns < endCell ) {
+                    add(cell + Columns);
+                } //if ( cell + Columns < endCell )
+                trails[cell] = sum;
+            } //for ( auto cell : levelInChunk(height) )
+        } //for ( std::size_t height = Summit; height-- > 0; )
+
+        //The ratings add up over the chunks, as well as the scores, since every summit is in exactly one chunk.
+        for ( auto cell : levelInChunk(0) ) {
+            ret.Scores  += std::popcount(trails[cell].Summits);
+            ret.Ratings += trails[cell].Paths;
+        } //for ( auto cell : levelInChunk(0) )
+    } //for ( std::size_t chunkBegin = 0; chunkBegin < summits.size(); chunkBegin += 64 )
+    return ret;
+}
+} //namespace day10
+
 bool challenge10(const std::vector<std::string_view>& input) {
-    MapView map{input};
-    Position::setMaxFromMap(map);
-    auto allStartPositions =
-        Position::allPositions() | std::views::filter([map](Position pos) noexcept { return map[pos] == '0'; });
-    const auto sum1 =
-        std::ranges::fold_left(allStartPositions | std::views::transform([map](Position startPosition) noexcept {
-                                   return calcScore(startPosition, map);
-                               }),
-                               0, std::plus<>{});
+    const auto [sum1, sum2] = day10::TrailMap{input}.sum();
     myPrint(" == Result of Part 1: {:d} ==\n", sum1);
-
-    auto sum2 =
-        std::ranges::fold_left(allStartPositions | std::views::transform([map](Position startPosition) noexcept {
-                                   return calcRating(startPosition, map);
-                               }),
-                               0, std::plus<>{});
-    ;
     myPrint(" == Result of Part 2: {:d} ==\n", sum2);
 
     return sum1 == 538 && sum2 == 1110;
@@ -1,9 +1,45 @@
 #ifndef CHALLENGE10_HPP
 #define CHALLENGE10_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
 bool challenge10(const std::vector<std::string_view>& input);
 
+namespace day10 {
+//The reference implementation, a depth first search from every trail head. Sets the bounds of Coordinate.
+std::int64_t sumScores(const std::vector<std::string_view>& map);
+std::int64_t sumRatings(const std::vector<std::string_view>& map);
+
+struct TrailSums {
+    std::int64_t Scores  = 0;
+    std::int64_t Ratings = 0;
+};
+
+//Computes both parts in one dynamic programming sweep over the heights, from 9 down to 0. Every cell gets the number of
+//paths to the summits, summed from its neighbours one higher, and the set of reachable summits as bits, ORed from the
+//same neighbours. The summits are handled in chunks of 64 in row major order, and since a trail spans at most 9 rows, a
+//chunk only sweeps the rows of its summits and 9 around them.
+class TrailMap {
+    public:
+    explicit TrailMap(const std::vector<std::string_view>& map);
+
+    TrailSums sum(void) const;
+
+    private:
+    static constexpr std::size_t  Summit  = 9;
+    //Cells without a digit are on no trail.
+    static constexpr std::uint8_t NoTrail = 10;
+
+    std::size_t                                      Rows;
+    std::size_t                                      Columns;
+    std::vector<std::uint8_t>                        Heights;
+    //The indices of the cells of each height, ascending.
+    std::array<std::vector<std::size_t>, Summit + 1> Levels;
+};
+} //namespace day10
+
 #endif //CHALLENGE10_HPP
@@ -4,32 +4,24 @@
 #include "print.hpp"
 
 #include <algorithm>
-#include <unordered_map>
+#include <array>
+#include <numeric>
+#include <ranges>
 
-namespace {
-struct Stone {
-    std::int64_t Value;
-    std::int64_t TimesToConvert;
-
-    bool operator==(const Stone&) const noexcept = default;
-};
+using day11::Stone;
 
+namespace {
 struct StoneHash {
     static std::size_t operator()(const Stone& stone) noexcept {
+        //Not packed into one value, that collides for more than 63 blinks.
         std::hash<std::int64_t> h;
-        return h(stone.Value << 6 | stone.TimesToConvert);
+        const auto              seed = h(stone.Value);
+        return seed ^ (h(stone.TimesToConvert) + 0x9E37'79B9'7F4A'7C15 + (seed << 6) + (seed >> 2));
     }
 };
 
 using Cache = std::unordered_map<Stone, std::int64_t, StoneHash>;
 
-struct BlinkResult {
-    Stone FirstStone;
-    Stone SecondStone;
-};
-
-static constexpr std::int64_t NoStone = -1;
-
 auto calcNumberOfDigits(std::int64_t number) noexcept {
     static constexpr auto logTable = [](void) noexcept {
         std::array<std::int64_t, 16> ret;
@@ -45,6 +37,14 @@ auto calcNumberOfDigits(std::int64_t number) noexcept {
     return std::ranges::distance(logTable.begin(), log);
 }
 
+void addCount(day11::StoneHistogram::Count& sum, day11::StoneHistogram::Count count) {
+    sum += count;
+    throwIfInvalid(sum >= count, "Too many stones for the count");
+    return;
+}
+} //namespace
+
+namespace day11 {
 BlinkResult blink(Stone stone) noexcept {
     const auto  toConvert = stone.TimesToConvert - 1;
     BlinkResult ret{{stone.Value, toConvert}, {NoStone, toConvert}};
@@ -65,14 +65,13 @@ BlinkResult blink(Stone stone) noexcept {
     } //else
     return ret;
 }
-} //namespace
 
-bool challenge11(const std::vector<std::string_view>& input) {
-    throwIfInvalid(input.size() == 1);
-    auto stones = splitString(input.front(), ' ') |
-                  std::views::transform([](std::string_view value) noexcept { return Stone{convert(value), 25}; }) |
-                  std::ranges::to<std::vector>();
+std::vector<std::int64_t> parse(std::string_view line) {
+    return splitString(line, ' ') | std::views::transform([](std::string_view value) { return convert(value); }) |
+           std::ranges::to<std::vector>();
+}
 
+std::int64_t countStones(std::span<const std::int64_t> values, std::int64_t blinks) {
     Cache cache;
     auto  calcStonesAfterBlinking = [&cache](this auto& self, const Stone& stone) noexcept -> std::int64_t {
         if ( stone.TimesToConvert == 0 ) {
@@ -94,11 +93,68 @@ bool challenge11(const std::vector<std::string_view>& input) {
         return ret;
     };
 
-    const auto sum1 = std::ranges::fold_left(stones | std::views::transform(calcStonesAfterBlinking), 0, std::plus<>{});
+    std::int64_t ret = 0;
+    for ( auto value : values ) {
+        ret += calcStonesAfterBlinking(Stone{value, blinks});
+    } //for ( auto value : values )
+    return ret;
+}
+
+StoneHistogram::StoneHistogram(std::span<const std::int64_t> values) {
+    for ( auto value : values ) {
+        ++Counts[value];
+    } //for ( auto value : values )
+    return;
+}
+
+StoneHistogram::Count StoneHistogram::count(void) const {
+    Count ret = 0;
+    for ( auto count : Counts | std::views::values ) {
+        addCount(ret, count);
+    } //for ( auto count : Counts | std::views::values )
+    return ret;
+}
+
+void StoneHistogram::blinkUntil(std::int64_t blinks) {
+    throwIfInvalid(blinks >= Blinks, "Can not blink backwards");
+    for ( ; Blinks < blinks; ++Blinks ) {
+        Next.clear();
+        for ( auto [value, count] : Counts ) {
+            const auto result = blink({value, 1});
+            addCount(Next[result.FirstStone.Value], count);
+            if ( result.SecondStone.Value != NoStone ) {
+                addCount(Next[result.SecondStone.Value], count);
+            } //if ( result.SecondStone.Value != NoStone )
+        } //for ( auto [value, count] : Counts )
+        std::swap(Counts, Next);
+    } //for ( ; Blinks < blinks; ++Blinks )
+    return;
+}
+
+std::vector<StoneHistogram::Count> StoneHistogram::countsAfter(std::span<const std::int64_t> blinks) {
+    std::vector<std::size_t> order(blinks.size());
+    std::iota(order.begin(), order.end(), 0zu);
+    std::ranges::sort(order, {}, [blinks](std::size_t index) noexcept { return blinks[index]; });
+
+    std::vector<Count> ret(blinks.size());
+    for ( auto index : order ) {
+        blinkUntil(blinks[index]);
+        ret[index] = count();
+    } //for ( auto index : order )
+    return ret;
+}
+} //namespace day11
+
+bool challenge11(const std::vector<std::string_view>& input) {
+    throwIfInvalid(input.size() == 1);
+    day11::StoneHistogram histogram{day11::parse(input.front())};
+    const auto            counts = histogram.countsAfter(std::array<std::int64_t, 2>{25, 75});
+
+    //Both fit into 64 bit.
+    const auto sum1 = static_cast<std::int64_t>(counts[0]);
     myPrint(" == Result of Part 1: {:d} ==\n", sum1);
 
-    std::ranges::fill(stones | std::views::transform(&Stone::TimesToConvert), 75);
-    const auto sum2 = std::ranges::fold_left(stones | std::views::transform(calcStonesAfterBlinking), 0, std::plus<>{});
+    const auto sum2 = static_cast<std::int64_t>(counts[1]);
     myPrint(" == Result of Part 2: {:d} ==\n", sum2);
 
     return sum1 == 197157 && sum2 == 234'430'066'982'597;
@@ -1,9 +1,69 @@
 #ifndef CHALLENGE11_HPP
 #define CHALLENGE11_HPP
 
+#include <cstdint>
+#include <span>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 bool challenge11(const std::vector<std::string_view>& input);
 
+namespace day11 {
+struct Stone {
+    std::int64_t Value;
+    std::int64_t TimesToConvert;
+
+    bool operator==(const Stone&) const noexcept = default;
+};
+
+struct BlinkResult {
+    Stone FirstStone;
+    Stone SecondStone;
+};
+
+constexpr std::int64_t NoStone = -1;
+
+BlinkResult blink(Stone stone) noexcept;
+
+std::vector<std::int64_t> parse(std::string_view line);
+
+//The reference implementation, recursive with a cache per stone and remaining blinks.
+std::int64_t countStones(std::span<const std::int64_t> values, std::int64_t blinks);
+
+//Keeps how many stones there are of each value, so every distinct value is blinked once per step, no matter how many
+//stones have it. The number of distinct values stays small, while the counts grow exponentially, so they are 128 bit.
+//That is enough for about 200 blinks.
+class StoneHistogram {
+    public:
+    __extension__ typedef unsigned __int128 Count;
+
+    explicit StoneHistogram(std::span<const std::int64_t> values);
+
+    std::int64_t blinks(void) const noexcept {
+        return Blinks;
+    }
+
+    std::size_t distinctValues(void) const noexcept {
+        return Counts.size();
+    }
+
+    //The number of stones after the blinks so far. Throws if it does not fit into a Count.
+    Count count(void) const;
+
+    //Blinks until blinks() is reached, which must not be less than the blinks so far.
+    void blinkUntil(std::int64_t blinks);
+
+    //The number of stones after each of the blinks, in the given order. They are answered in one run, in ascending
+    //order, from blinks() on, so none may be less than that.
+    std::vector<Count> countsAfter(std::span<const std::int64_t> blinks);
+
+    private:
+    std::int64_t                            Blinks = 0;
+    std::unordered_map<std::int64_t, Count> Counts;
+    //Only to keep the allocated buckets between the blinks.
+    std::unordered_map<std::int64_t, Count> Next;
+};
+} //namespace day11
+
 #endif //CHALLENGE11_HPP
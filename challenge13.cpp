@@ -1,11 +1,15 @@
 #include "challenge13.hpp"
 
 #include "helper.hpp"
+#include "linereader.hpp"
 #include "print.hpp"
 #include "3rdParty/ctre/include/ctre.hpp"
 
 #include <algorithm>
+#include <array>
+#include <iterator>
 #include <ranges>
+#include <string>
 
 namespace {
 struct Equation {
@@ -71,26 +75,30 @@ struct ClawMachine {
     }
 };
 
-auto parse(const std::vector<std::string_view>& input) {
+ClawMachine parseMachine(std::string_view aLine, std::string_view bLine, std::string_view prizeLine) {
     auto buttonRegEx = ctre::match<R"(Button .: X\+(\d+), Y\+(\d+))">;
     auto prizeRegEx  = ctre::match<R"(Prize: X=(\d+), Y=(\d+))">;
 
-    std::vector<ClawMachine> ret;
-    for ( auto machineInput : input | std::views::chunk(4) ) {
-        throwIfInvalid(std::ranges::distance(machineInput) >= 3);
-        auto iter       = std::ranges::begin(machineInput);
-        auto aMatch     = buttonRegEx(*iter);
-        auto bMatch     = buttonRegEx(*++iter);
-        auto prizeMatch = prizeRegEx(*++iter);
+    auto aMatch      = buttonRegEx(aLine);
+    auto bMatch      = buttonRegEx(bLine);
+    auto prizeMatch  = prizeRegEx(prizeLine);
 
-        throwIfInvalid(aMatch && bMatch && prizeMatch);
+    throwIfInvalid(aMatch && bMatch && prizeMatch);
 
-        auto matchesToEquation = [&]<std::size_t I>(void) noexcept {
-            return Equation{convert(aMatch.get<I>().view()), convert(bMatch.get<I>().view()),
-                            convert(prizeMatch.get<I>().view())};
-        };
+    auto matchesToEquation = [&]<std::size_t I>(void) noexcept {
+        return Equation{convert(aMatch.get<I>().view()), convert(bMatch.get<I>().view()),
+                        convert(prizeMatch.get<I>().view())};
+    };
 
-        ret.push_back(ClawMachine{matchesToEquation.operator()<1>(), matchesToEquation.operator()<2>()});
+    return ClawMachine{matchesToEquation.operator()<1>(), matchesToEquation.operator()<2>()};
+}
+
+auto parse(const std::vector<std::string_view>& input) {
+    std::vector<ClawMachine> ret;
+    for ( auto machineInput : input | std::views::chunk(4) ) {
+        throwIfInvalid(std::ranges::distance(machineInput) >= 3);
+        auto iter = std::ranges::begin(machineInput);
+        ret.push_back(parseMachine(*iter, *std::next(iter), *std::next(iter, 2)));
     } //for ( auto inputLine : input )
     return ret;
 }
@@ -110,3 +118,36 @@ bool challenge13(const std::vector<std::string_view>& input) {
 
     return sum1 == 37901 && sum2 == 77'407'675'412'647;
 }
+
+bool challenge13Streaming(LineReader& input) {
+    std::int64_t sum1 = 0;
+    std::int64_t sum2 = 0;
+
+    //The lines of one machine, the views are only valid until the next read, so we have to copy them.
+    std::array<std::string, 3> machineInput;
+    std::size_t                linesRead = 0;
+
+    while ( auto line = input.next() ) {
+        if ( line->empty() ) {
+            throwIfInvalid(linesRead == 0);
+            continue;
+        } //if ( line->empty() )
+
+        machineInput[linesRead].assign(*line);
+        if ( ++linesRead != machineInput.size() ) {
+            continue;
+        } //if ( ++linesRead != machineInput.size() )
+
+        linesRead    = 0;
+        auto machine = parseMachine(machineInput[0], machineInput[1], machineInput[2]);
+        sum1        += machine.costOfWinning();
+        machine.bumpForPart2();
+        sum2        += machine.costOfWinning();
+    } //while ( auto line = input.next() )
+    throwIfInvalid(linesRead == 0);
+
+    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+
+    return sum1 == 37901 && sum2 == 77'407'675'412'647;
+}
@@ -4,6 +4,9 @@
 #include <string_view>
 #include <vector>
 
+class LineReader;
+
 bool challenge13(const std::vector<std::string_view>& input);
+bool challenge13Streaming(LineReader& input);
 
 #endif //CHALLENGE13_HPP
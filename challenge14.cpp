@@ -1,11 +1,13 @@
 #include "challenge14.hpp"
 
 #include "helper.hpp"
+#include "linereader.hpp"
 #include "print.hpp"
 #include "3rdParty/ctre/include/ctre.hpp"
 
 #include <algorithm>
 #include <ranges>
+#include <vector>
 
 namespace {
 using Position                 = Coordinate<std::int64_t>;
@@ -14,8 +16,10 @@ using Offset                   = CoordinateOffset<std::int64_t>;
 constexpr auto NumberOfRows    = 103;
 constexpr auto NumberOfColumns = 101;
 
-inline void mod(std::int64_t& x, int m) noexcept {
-    x = ((x % m) + m) % m;
+//The dimensions are fixed, with the modulus as constant the division becomes a multiplication.
+template<std::int64_t M>
+inline void mod(std::int64_t& x) noexcept {
+    x = ((x % M) + M) % M;
     return;
 }
 
@@ -25,15 +29,15 @@ struct Robot {
 
     void move(void) noexcept {
         Start += Movement;
-        mod(Start.Row, NumberOfRows);
-        mod(Start.Column, NumberOfColumns);
+        mod<NumberOfRows>(Start.Row);
+        mod<NumberOfColumns>(Start.Column);
         return;
     }
 
     Position positionAfter100Moves(void) const noexcept {
         auto ret = Start + Movement * 100;
-        mod(ret.Row, NumberOfRows);
-        mod(ret.Column, NumberOfColumns);
+        mod<NumberOfRows>(ret.Row);
+        mod<NumberOfColumns>(ret.Column);
         return ret;
     }
 
@@ -43,16 +47,14 @@ struct Robot {
                 {convert(match.get<4>().view()), convert(match.get<3>().view())}};
     }
 };
-} //namespace
 
-bool challenge14(const std::vector<std::string_view>& input) {
-    auto robots            = input | std::views::transform(&Robot::parse) | std::ranges::to<std::vector>();
+struct QuadrantCounter {
+    std::int64_t TopLeftRobots     = 0;
+    std::int64_t TopRightRobots    = 0;
+    std::int64_t BottomLeftRobots  = 0;
+    std::int64_t BottomRightRobots = 0;
 
-    auto topLeftRobots     = 0;
-    auto topRightRobots    = 0;
-    auto bottomLeftRobots  = 0;
-    auto bottomRightRobots = 0;
-    auto count = [&topLeftRobots, &topRightRobots, &bottomLeftRobots, &bottomRightRobots](const Robot& robot) noexcept {
+    void operator()(const Robot& robot) noexcept {
         const auto position         = robot.positionAfter100Moves();
 
         constexpr auto middleColumn = NumberOfColumns / 2;
@@ -62,12 +64,12 @@ bool challenge14(const std::vector<std::string_view>& input) {
             return;
         } //if ( position.Row == middleRow || position.Column == middleColumn )
 
-        auto left  = &bottomLeftRobots;
-        auto right = &bottomRightRobots;
+        auto left  = &BottomLeftRobots;
+        auto right = &BottomRightRobots;
 
         if ( position.Row < middleRow ) {
-            left  = &topLeftRobots;
-            right = &topRightRobots;
+            left  = &TopLeftRobots;
+            right = &TopRightRobots;
         } //if ( position.Row < middleRow )
 
         if ( position.Column < middleColumn ) {
@@ -77,12 +79,14 @@ bool challenge14(const std::vector<std::string_view>& input) {
             ++*right;
         } //else -> if ( position.Column < middleColumn )
         return;
-    };
-    std::ranges::for_each(robots, count);
+    }
 
-    const auto safetyFactor = topLeftRobots * topRightRobots * bottomLeftRobots * bottomRightRobots;
-    myPrint(" == Result of Part 1: {:d} ==\n", safetyFactor);
+    std::int64_t safetyFactor(void) const noexcept {
+        return TopLeftRobots * TopRightRobots * BottomLeftRobots * BottomRightRobots;
+    }
+};
 
+std::int64_t findStepsToTree(std::vector<Robot>& robots) noexcept {
     //Had to look at reddit... who thinks of something like this?!?
     auto isATree = [&robots](void) noexcept {
         auto fullyCircled = [&robots](const Robot& robot) noexcept {
@@ -95,11 +99,44 @@ bool challenge14(const std::vector<std::string_view>& input) {
         return std::ranges::any_of(robots, fullyCircled);
     };
 
-    auto stepsToTree = 0;
+    std::int64_t stepsToTree = 0;
     do {
         ++stepsToTree;
         std::ranges::for_each(robots, &Robot::move);
     } while ( !isATree() );
+    return stepsToTree;
+}
+} //namespace
+
+bool challenge14(const std::vector<std::string_view>& input) {
+    auto robots = input | std::views::transform(&Robot::parse) | std::ranges::to<std::vector>();
+
+    const auto safetyFactor = std::ranges::for_each(robots, QuadrantCounter{}).fun.safetyFactor();
+    myPrint(" == Result of Part 1: {:d} ==\n", safetyFactor);
+
+    const auto stepsToTree = findStepsToTree(robots);
+    myPrint(" == Result of Part 2: {:d} ==\n", stepsToTree);
+
+    return safetyFactor == 225'521'010 && stepsToTree == 7774;
+}
+
+bool challenge14Streaming(LineReader& input) {
+    //Part 1 is a pure reduction, for part 2 we have to keep the robots (but not the lines).
+    QuadrantCounter    count;
+    std::vector<Robot> robots;
+
+    while ( auto line = input.next() ) {
+        if ( line->empty() ) {
+            continue;
+        } //if ( line->empty() )
+
+        count(robots.emplace_back(Robot::parse(*line)));
+    } //while ( auto line = input.next() )
+
+    const auto safetyFactor = count.safetyFactor();
+    myPrint(" == Result of Part 1: {:d} ==\n", safetyFactor);
+
+    const auto stepsToTree = findStepsToTree(robots);
     myPrint(" == Result of Part 2: {:d} ==\n", stepsToTree);
 
     return safetyFactor == 225'521'010 && stepsToTree == 7774;
@@ -4,6 +4,9 @@
 #include <string_view>
 #include <vector>
 
+class LineReader;
+
 bool challenge14(const std::vector<std::string_view>& input);
+bool challenge14Streaming(LineReader& input);
 
 #endif //CHALLENGE14_HPP
@@ -2,6 +2,7 @@
 
 #include "helper.hpp"
 #include "print.hpp"
+#include "specialize.hpp"
 
 #include <iterator>
 #include <ranges>
@@ -34,9 +35,7 @@ struct Computer {
     std::vector<std::int8_t>::const_iterator Pc;
     std::vector<std::int8_t>                 Output;
 
-    bool performNextOperation(void) noexcept {
-        return perform(static_cast<Operation>(*Pc), static_cast<std::uint8_t>(*std::next(Pc)));
-    }
+    bool performNextOperation(void) noexcept;
 
     std::string compute(void) noexcept {
         Pc = Program.begin();
@@ -124,8 +123,74 @@ struct Computer {
         std::advance(Pc, 2);
         return op == Operation::out;
     }
+
+    template<std::uint8_t Operand>
+    std::int64_t getFixedValue(void) const noexcept {
+        constexpr auto operand = static_cast<ComboOperand>(Operand);
+        if constexpr ( operand == ComboOperand::RegisterA ) {
+            return A;
+        } //if constexpr ( operand == ComboOperand::RegisterA )
+        else if constexpr ( operand == ComboOperand::RegisterB ) {
+            return B;
+        } //else if constexpr ( operand == ComboOperand::RegisterB )
+        else if constexpr ( operand == ComboOperand::RegisterC ) {
+            return C;
+        } //else if constexpr ( operand == ComboOperand::RegisterC )
+        else if constexpr ( operand == ComboOperand::Invalid ) {
+            throwIfInvalid(false);
+            return 0;
+        } //else if constexpr ( operand == ComboOperand::Invalid )
+        else {
+            return Operand;
+        } //else
+    }
+
+    //Same as perform, but with operation and operand known at compile time, so no switch is left.
+    template<Operation Op, std::uint8_t Operand>
+    bool performFixed(void) noexcept {
+        if constexpr ( Op == Operation::adv ) {
+            A = A / (1 << getFixedValue<Operand>());
+        } //if constexpr ( Op == Operation::adv )
+        else if constexpr ( Op == Operation::bdv ) {
+            B = A / (1 << getFixedValue<Operand>());
+        } //else if constexpr ( Op == Operation::bdv )
+        else if constexpr ( Op == Operation::cdv ) {
+            C = A / (1 << getFixedValue<Operand>());
+        } //else if constexpr ( Op == Operation::cdv )
+        else if constexpr ( Op == Operation::bxl ) {
+            B ^= Operand;
+        } //else if constexpr ( Op == Operation::bxl )
+        else if constexpr ( Op == Operation::bst ) {
+            B = getFixedValue<Operand>() & 0x7;
+        } //else if constexpr ( Op == Operation::bst )
+        else if constexpr ( Op == Operation::bxc ) {
+            B ^= C;
+        } //else if constexpr ( Op == Operation::bxc )
+        else if constexpr ( Op == Operation::out ) {
+            Output.push_back(static_cast<std::int8_t>(getFixedValue<Operand>() & 0x7));
+        } //else if constexpr ( Op == Operation::out )
+        else {
+            if ( A != 0 ) {
+                Pc = std::next(Program.begin(), Operand);
+                return false;
+            } //if ( A != 0 )
+        } //else -> Op == Operation::jnz
+
+        std::advance(Pc, 2);
+        return Op == Operation::out;
+    }
 };
 
+//One specialization of performFixed for each of the 8 * 8 combinations of operation and operand.
+constexpr auto InstructionTable = makeDispatchTable<64>([]<std::size_t Index>(void) noexcept {
+    return &Computer::performFixed<static_cast<Operation>(Index / 8), static_cast<std::uint8_t>(Index % 8)>;
+});
+
+bool Computer::performNextOperation(void) noexcept {
+    const auto index = static_cast<std::size_t>(*Pc) * 8 + static_cast<std::size_t>(*std::next(Pc));
+    return (this->*InstructionTable[index])();
+}
+
 Computer parse(std::span<const std::string_view> input) {
     throwIfInvalid(input.size() == 5);
     auto aLine        = input[0];
@@ -146,10 +211,20 @@ Computer parse(std::span<const std::string_view> input) {
     auto code = input[4];
     throwIfInvalid(code.starts_with("Program: "));
     ret.ProgramString = code.substr("Program: "sv.size());
+    //performNextOperation indexes the instruction table without any check, and Pc has to stay on the instructions.
     ret.Program       = splitString(ret.ProgramString, ',') | std::views::transform(convert<10>) |
-                  std::views::transform([](auto x) noexcept { return static_cast<std::int8_t>(x); }) |
+                  std::views::transform([](std::int64_t x) {
+                      throwIfInvalid(x >= 0 && x <= 7, "Program values have to be in [0, 7]");
+                      return static_cast<std::int8_t>(x);
+                  }) |
                   std::ranges::to<std::vector>();
-
+    throwIfInvalid(ret.Program.size() % 2 == 0, "Program has to consist of pairs of operation and operand");
+    for ( auto index = 0zu; index < ret.Program.size(); index += 2 ) {
+        if ( ret.Program[index] == std::to_underlying(Operation::jnz) ) {
+            const auto target = static_cast<std::size_t>(ret.Program[index + 1]);
+            throwIfInvalid(target % 2 == 0 && target <= ret.Program.size(), "Invalid jump target");
+        } //if ( ret.Program[index] == std::to_underlying(Operation::jnz) )
+    } //for ( auto index = 0zu; index < ret.Program.size(); index += 2 )
     return ret;
 }
 
@@ -205,6 +280,34 @@ std::int64_t findCopyA(Computer& computer) {
 }
 } //namespace
 
+namespace day17 {
+template<bool Specialized>
+std::int64_t runForRegisterValues(std::span<const std::string_view> input, std::int64_t firstA, std::int64_t count) {
+    auto         computer = parse(input);
+    std::int64_t outputs  = 0;
+
+    for ( auto a = firstA; a < firstA + count; ++a ) {
+        computer.reset(a);
+        while ( computer.Pc != computer.Program.end() ) {
+            if constexpr ( Specialized ) {
+                computer.performNextOperation();
+            } //if constexpr ( Specialized )
+            else {
+                computer.perform(static_cast<Operation>(*computer.Pc),
+                                 static_cast<std::uint8_t>(*std::next(computer.Pc)));
+            } //else -> if constexpr ( Specialized )
+        } //while ( computer.Pc != computer.Program.end() )
+        outputs += std::ssize(computer.Output);
+    } //for ( auto a = firstA; a < firstA + count; ++a )
+    return outputs;
+}
+
+template std::int64_t runForRegisterValues<false>(std::span<const std::string_view> input, std::int64_t firstA,
+                                                  std::int64_t count);
+template std::int64_t runForRegisterValues<true>(std::span<const std::string_view> input, std::int64_t firstA,
+                                                 std::int64_t count);
+} //namespace day17
+
 bool challenge17(const std::vector<std::string_view>& input) {
     auto computer     = parse(input);
 
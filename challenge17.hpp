@@ -1,9 +1,18 @@
 #ifndef CHALLENGE17_HPP
 #define CHALLENGE17_HPP
 
+#include <cstdint>
+#include <span>
 #include <string_view>
 #include <vector>
 
 bool challenge17(const std::vector<std::string_view>& input);
 
+namespace day17 {
+//Runs the program once for each A in [firstA, firstA + count), returns the number of outputs. Specialized selects the
+//jump table of performFixed over the switch in perform.
+template<bool Specialized>
+std::int64_t runForRegisterValues(std::span<const std::string_view> input, std::int64_t firstA, std::int64_t count);
+} //namespace day17
+
 #endif //CHALLENGE17_HPP
@@ -1,35 +1,31 @@
 #include "challenge2.hpp"
 
 #include "helper.hpp"
+#include "linereader.hpp"
 #include "print.hpp"
 
 #include <algorithm>
-#include <functional>
 #include <ranges>
+#include <utility>
 
 namespace {
-bool isSafe(std::span<const std::int64_t> distances) noexcept {
-    return std::ranges::all_of(distances, [](auto level) noexcept { return level >= 1 && level <= 3; }) ||
-           std::ranges::all_of(distances, [](auto level) noexcept { return level >= -3 && level <= -1; });
-}
-
 bool isDampenedSafeImpl(const std::vector<std::int64_t>& distances, bool alreadyInverted) noexcept {
     if ( distances.front() == 0 ) {
-        return isSafe(std::span{distances}.subspan(1));
+        return day2::isSafe(std::span{distances}.subspan(1));
     } //if ( distances.front() == 0 )
 
     auto firstBad =
         std::ranges::find_if(distances, [](auto distance) noexcept { return distance < 1 || distance > 3; });
 
     if ( firstBad == distances.begin() ) {
-        if ( isSafe(std::span{distances}.subspan(1)) ) {
+        if ( day2::isSafe(std::span{distances}.subspan(1)) ) {
             return true;
-        } //if ( isSafe(std::span{distances}.subspan(1)) )
+        } //if ( day2::isSafe(std::span{distances}.subspan(1)) )
     } //if ( firstBad == distances.begin() )
     else if ( firstBad == std::prev(distances.end()) ) {
-        if ( isSafe(std::span{distances}.subspan(0, distances.size() - 1)) ) {
+        if ( day2::isSafe(std::span{distances}.subspan(0, distances.size() - 1)) ) {
             return true;
-        } //if ( isSafe(std::span{distances}.subspan(0, distances.size() - 1)) ) {
+        } //if ( day2::isSafe(std::span{distances}.subspan(0, distances.size() - 1)) ) {
     } //if ( firstBad == std::prev(distances.end()) )
     /*else */{
         const auto index = static_cast<int>(std::ranges::distance(distances.begin(), firstBad));
@@ -40,7 +36,7 @@ bool isDampenedSafeImpl(const std::vector<std::int64_t>& distances, bool already
             const auto carry     = *toRemove;
             auto       toMerge   = copy.erase(toRemove);
             *toMerge            += carry;
-            if ( isSafe(copy) ) {
+            if ( day2::isSafe(copy) ) {
                 return true;
             }
         } //
@@ -56,30 +52,191 @@ bool isDampenedSafeImpl(const std::vector<std::int64_t>& distances, bool already
     return false;
 }
 
+//Checks the reports in batches, only the ones which do not fit are checked one by one.
+class ReportCounter {
+    public:
+    void add(std::string_view line) {
+        if ( Batch.add(line) ) {
+            if ( Batch.full() ) {
+                flush();
+            } //if ( Batch.full() )
+            return;
+        } //if ( Batch.add(line) )
+
+        const auto report = day2::checkReport(line);
+        if ( report.isSafe() ) {
+            ++NumberOfSafeReports;
+        } //if ( report.isSafe() )
+        if ( report.isDampenedSafe() ) {
+            ++NumberOfDampenedSafeReports;
+        } //if ( report.isDampenedSafe() )
+        return;
+    }
+
+    //Returns the number of safe reports, without and with the dampener.
+    std::pair<std::int64_t, std::int64_t> finish(void) noexcept {
+        flush();
+        return {NumberOfSafeReports, NumberOfDampenedSafeReports};
+    }
+
+    private:
+    day2::ReportBatch Batch;
+    std::int64_t      NumberOfSafeReports         = 0;
+    std::int64_t      NumberOfDampenedSafeReports = 0;
+
+    void flush(void) noexcept {
+        NumberOfSafeReports         += Batch.countSafe();
+        NumberOfDampenedSafeReports += Batch.countSafeWithDampener();
+        Batch.clear();
+        return;
+    }
+};
+} //namespace
+
+namespace day2 {
+bool isSafe(std::span<const std::int64_t> distances) noexcept {
+    return std::ranges::all_of(distances, [](auto level) noexcept { return level >= 1 && level <= 3; }) ||
+           std::ranges::all_of(distances, [](auto level) noexcept { return level >= -3 && level <= -1; });
+}
+
 bool isDampenedSafe(const std::vector<std::int64_t>& distances) noexcept {
     return isDampenedSafeImpl(distances, /*alreadyInverted=*/false);
 }
-} //namespace
+
+std::vector<std::int64_t> toDifferences(std::string_view line) noexcept {
+    return splitString(line, ' ') |
+           std::views::transform([](std::string_view level) noexcept { return convert(level); }) |
+           std::views::slide(2) |
+           std::views::transform([](auto window) noexcept { return *std::next(window.begin()) - *window.begin(); }) |
+           std::ranges::to<std::vector<std::int64_t>>();
+}
+
+void ReportChecker::add(std::int64_t level) noexcept {
+    Increasing.add(*this, level, 1);
+    Decreasing.add(*this, level, -1);
+    PrePrevious = Previous;
+    Previous    = level;
+    ++Count;
+    return;
+}
+
+void ReportChecker::Chains::add(const ReportChecker& report, std::int64_t level, std::int64_t sign) noexcept {
+    auto isStep = [sign](std::int64_t from, std::int64_t to) noexcept {
+        const auto step = (to - from) * sign;
+        return step >= 1 && step <= 3;
+    };
+
+    if ( report.Count == 0 ) {
+        Clean = true;
+        return;
+    } //if ( report.Count == 0 )
+
+    //Removing the first level always leaves a chain of one. Otherwise either the new level continues a chain with a
+    //removal, or it continues the chain where the previous level was removed.
+    const bool removedEarlier = report.Count == 1 || (RemovedEarlier && isStep(report.Previous, level)) ||
+                                (SkippedPrevious && isStep(report.PrePrevious, level));
+    SkippedPrevious           = Clean;
+    Clean                     = Clean && isStep(report.Previous, level);
+    RemovedEarlier            = removedEarlier;
+    return;
+}
+
+ReportChecker checkReport(std::string_view line) {
+    ReportChecker ret;
+    for ( auto level : splitString(line, ' ') ) {
+        ret.add(convert(level));
+    } //for ( auto level : splitString(line, ' ') )
+    return ret;
+}
+
+bool ReportBatch::add(std::string_view line) {
+    if ( full() ) {
+        return false;
+    } //if ( full() )
+
+    std::size_t numberOfLevels = 0;
+    for ( auto level : splitString(line, ' ') ) {
+        const auto value = convert(level);
+        //Small enough, that the differences can not overflow.
+        if ( numberOfLevels == MaxLevels || !std::in_range<std::int16_t>(value) ) {
+            return false;
+        } //if ( numberOfLevels == MaxLevels || !std::in_range<std::int16_t>(value) )
+        Levels[numberOfLevels++][Size] = static_cast<std::int32_t>(value);
+    } //for ( auto level : splitString(line, ' ') )
+    NumberOfLevels[Size++] = static_cast<std::int32_t>(numberOfLevels);
+    return true;
+}
+
+ReportBatch::Lanes ReportBatch::safeWithout(std::size_t skipped) const noexcept {
+    Lanes increasing;
+    Lanes decreasing;
+    increasing.fill(1);
+    decreasing.fill(1);
+
+    std::size_t previous = skipped == 0 ? 1 : 0;
+    for ( auto level = previous + 1; level < MaxLevels; ++level ) {
+        if ( level == skipped ) {
+            continue;
+        } //if ( level == skipped )
+
+        //Levels beyond the end of a report do not count.
+        for ( std::size_t report = 0; report < Width; ++report ) {
+            const auto difference  = Levels[level][report] - Levels[previous][report];
+            const int  padding     = static_cast<std::int32_t>(level) >= NumberOfLevels[report];
+            increasing[report]    &= padding | ((difference >= 1) & (difference <= 3));
+            decreasing[report]    &= padding | ((difference >= -3) & (difference <= -1));
+        } //for ( std::size_t report = 0; report < Width; ++report )
+        previous = level;
+    } //for ( auto level = previous + 1; level < MaxLevels; ++level )
+
+    for ( std::size_t report = 0; report < Width; ++report ) {
+        increasing[report] |= decreasing[report];
+    } //for ( std::size_t report = 0; report < Width; ++report )
+    return increasing;
+}
+
+std::int64_t ReportBatch::countSafe(void) const noexcept {
+    const auto safe = safeWithout(MaxLevels);
+    return std::ranges::count(std::span{safe}.first(Size), 1);
+}
+
+std::int64_t ReportBatch::countSafeWithDampener(void) const noexcept {
+    auto safe = safeWithout(MaxLevels);
+    for ( std::size_t skipped = 0; skipped < MaxLevels; ++skipped ) {
+        const auto safeWithoutSkipped = safeWithout(skipped);
+        for ( std::size_t report = 0; report < Width; ++report ) {
+            safe[report] |= safeWithoutSkipped[report];
+        } //for ( std::size_t report = 0; report < Width; ++report )
+    } //for ( std::size_t skipped = 0; skipped < MaxLevels; ++skipped )
+    return std::ranges::count(std::span{safe}.first(Size), 1);
+}
+} //namespace day2
 
 bool challenge2(const std::vector<std::string_view>& input) {
-    std::vector reportsDifferences =
-        input | std::views::transform([](auto line) noexcept {
-            return splitString(line, ' ') |
-                   std::views::transform([](std::string_view level) noexcept { return convert(level); }) |
-                   std::views::slide(2) | std::views::transform([](auto window) noexcept {
-                       return *std::next(window.begin()) - *window.begin();
-                   }) |
-                   std::ranges::to<std::vector<std::int64_t>>();
-        }) |
-        std::ranges::to<std::vector>();
-    auto       unsafeReports       = reportsDifferences | std::views::filter(std::not_fn(isSafe));
-    const auto numberOfSafeReports = std::ssize(input) - std::ranges::distance(unsafeReports);
+    ReportCounter counter;
+    for ( auto line : input ) {
+        counter.add(line);
+    } //for ( auto line : input )
 
+    const auto [numberOfSafeReports, sum2] = counter.finish();
     myPrint(" == Result of Part 1: {:d} ==\n", numberOfSafeReports);
+    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
 
-    const auto numberOfDampenedSafeReports = std::ranges::count_if(unsafeReports, isDampenedSafe);
+    return numberOfSafeReports == 559 && sum2 == 601;
+}
+
+bool challenge2Streaming(LineReader& input) {
+    ReportCounter counter;
+    while ( auto line = input.next() ) {
+        if ( line->empty() ) {
+            continue;
+        } //if ( line->empty() )
 
-    const auto sum2                        = numberOfSafeReports + numberOfDampenedSafeReports;
+        counter.add(*line);
+    } //while ( auto line = input.next() )
+
+    const auto [numberOfSafeReports, sum2] = counter.finish();
+    myPrint(" == Result of Part 1: {:d} ==\n", numberOfSafeReports);
     myPrint(" == Result of Part 2: {:d} ==\n", sum2);
 
     return numberOfSafeReports == 559 && sum2 == 601;
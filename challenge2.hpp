@@ -1,9 +1,95 @@
 #ifndef CHALLENGE2_HPP
 #define CHALLENGE2_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string_view>
 #include <vector>
 
+class LineReader;
+
 bool challenge2(const std::vector<std::string_view>& input);
+bool challenge2Streaming(LineReader& input);
+
+namespace day2 {
+//The reference implementation, on the differences of the levels.
+std::vector<std::int64_t> toDifferences(std::string_view line) noexcept;
+bool                      isSafe(std::span<const std::int64_t> distances) noexcept;
+bool                      isDampenedSafe(const std::vector<std::int64_t>& distances) noexcept;
+
+//Gets the levels of a report one by one, and tracks in one pass and without allocation whether the report is safe, with
+//or without removing one level. For both directions it keeps three chains of valid steps: one without any removal, one
+//with an earlier removal (both ending in the last level), and one where the last level is removed.
+class ReportChecker {
+    public:
+    void add(std::int64_t level) noexcept;
+
+    bool isSafe(void) const noexcept {
+        return Increasing.Clean || Decreasing.Clean;
+    }
+
+    bool isDampenedSafe(void) const noexcept {
+        return Increasing.any() || Decreasing.any();
+    }
+
+    private:
+    struct Chains {
+        bool Clean           = false;
+        bool RemovedEarlier  = false;
+        bool SkippedPrevious = false;
+
+        bool any(void) const noexcept {
+            return Clean || RemovedEarlier || SkippedPrevious;
+        }
+
+        void add(const ReportChecker& report, std::int64_t level, std::int64_t sign) noexcept;
+    };
+
+    Chains       Increasing;
+    Chains       Decreasing;
+    std::int64_t Count       = 0;
+    std::int64_t Previous    = 0;
+    std::int64_t PrePrevious = 0;
+};
+
+ReportChecker checkReport(std::string_view line);
+
+//Checks many reports at once. The levels are stored as structure of arrays, one array per level index with an entry
+//for every report, so the checks are plain loops over the reports which the compiler vectorizes.
+class ReportBatch {
+    public:
+    static constexpr std::size_t Width     = 32;
+    static constexpr std::size_t MaxLevels = 8;
+
+    //Returns false, if the report does not fit into the batch, or the batch is full. It then has to be checked on its
+    //own.
+    bool add(std::string_view line);
+
+    bool full(void) const noexcept {
+        return Size == Width;
+    }
+
+    void clear(void) noexcept {
+        Size = 0;
+        return;
+    }
+
+    std::int64_t countSafe(void) const noexcept;
+    //Including the ones which are already safe.
+    std::int64_t countSafeWithDampener(void) const noexcept;
+
+    private:
+    using Lanes = std::array<std::int32_t, Width>;
+
+    std::array<Lanes, MaxLevels> Levels{};
+    Lanes                        NumberOfLevels{};
+    std::size_t                  Size = 0;
+
+    //Which reports are safe after removing the level skipped, for skipped >= MaxLevels none is removed.
+    Lanes safeWithout(std::size_t skipped) const noexcept;
+};
+} //namespace day2
 
 #endif //CHALLENGE2_HPP
@@ -1,19 +1,23 @@
 #include "challenge22.hpp"
 
 #include "helper.hpp"
+#include "linereader.hpp"
 #include "print.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <ranges>
+#include <vector>
+
+using day22::SecretNumbers;
 
 namespace {
 std::int64_t mixAndPrune(std::int64_t secret, std::int64_t number) noexcept {
     return (secret ^ number) % 16777216;
 }
+} //namespace
 
-using SecretNumbers    = std::vector<std::int64_t>;
-using OffsetsAndPrices = std::vector<std::pair<std::int64_t, std::int64_t>>;
-
+namespace day22 {
 SecretNumbers generateSecretNumbers(std::int64_t secret) noexcept {
     SecretNumbers ret;
     ret.resize(2001);
@@ -26,6 +30,10 @@ SecretNumbers generateSecretNumbers(std::int64_t secret) noexcept {
     });
     return ret;
 }
+} //namespace day22
+
+namespace {
+using OffsetsAndPrices = std::vector<std::pair<std::int64_t, std::int64_t>>;
 
 OffsetsAndPrices toOffsets(const SecretNumbers& numbers) noexcept {
     OffsetsAndPrices ret;
@@ -96,11 +104,53 @@ void searchBestPriceSum(SearchState& state, int level = 0) noexcept {
     } //for ( auto nextOffset : std::views::iota(-9, 10) )
     return;
 }
+
+//Sums per sequence of four changes the price at its first occurrence per monkey, without keeping the secret numbers.
+//A change lies in [-9, 9], so a sequence is encoded base 19 as index.
+class BananaSums {
+    public:
+    static constexpr std::size_t NumberOfSequences = 19 * 19 * 19 * 19;
+
+    BananaSums(void) : Sums(NumberOfSequences, 0), SeenBy(NumberOfSequences, 0) {
+        return;
+    }
+
+    std::int64_t add(std::int64_t secret) noexcept {
+        ++Monkey;
+        std::size_t sequence      = 0;
+        auto        previousPrice = secret % 10;
+
+        for ( auto step = 1; step <= 2000; ++step ) {
+            secret           = mixAndPrune(secret, secret * 64);
+            secret           = mixAndPrune(secret, secret / 32);
+            secret           = mixAndPrune(secret, secret * 2048);
+
+            const auto price = secret % 10;
+            sequence         = (sequence * 19 + static_cast<std::size_t>(price - previousPrice + 9)) % NumberOfSequences;
+            previousPrice    = price;
+
+            if ( step >= 4 && SeenBy[sequence] != Monkey ) {
+                SeenBy[sequence]  = Monkey;
+                Sums[sequence]   += price;
+            } //if ( step >= 4 && SeenBy[sequence] != Monkey )
+        } //for ( auto step = 1; step <= 2000; ++step )
+        return secret;
+    }
+
+    std::int64_t best(void) const noexcept {
+        return std::ranges::max(Sums);
+    }
+
+    private:
+    std::vector<std::int64_t>  Sums;
+    std::vector<std::uint32_t> SeenBy;
+    std::uint32_t              Monkey = 0;
+};
 } //namespace
 
 bool challenge22(const std::vector<std::string_view>& input) {
     const auto secretNumbers = input | std::views::transform(convert<10>) |
-                               std::views::transform(generateSecretNumbers) | std::ranges::to<std::vector>();
+                               std::views::transform(day22::generateSecretNumbers) | std::ranges::to<std::vector>();
     const auto sum1 = std::ranges::fold_left(
         secretNumbers | std::views::transform([](const SecretNumbers& numbers) noexcept { return numbers.back(); }), 0,
         std::plus<>{});
@@ -122,3 +172,22 @@ bool challenge22(const std::vector<std::string_view>& input) {
 
     return sum1 == 15'608'699'004 && bestPriceSum == 1791;
 }
+
+bool challenge22Streaming(LineReader& input) {
+    std::int64_t sum1 = 0;
+    BananaSums   bananaSums;
+
+    while ( auto line = input.next() ) {
+        if ( line->empty() ) {
+            continue;
+        } //if ( line->empty() )
+
+        sum1 += bananaSums.add(convert(*line));
+    } //while ( auto line = input.next() )
+    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+
+    const auto bestPriceSum = bananaSums.best();
+    myPrint(" == Result of Part 2: {:d} ==\n", bestPriceSum);
+
+    return sum1 == 15'608'699'004 && bestPriceSum == 1791;
+}
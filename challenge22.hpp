@@ -1,9 +1,19 @@
 #ifndef CHALLENGE22_HPP
 #define CHALLENGE22_HPP
 
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
+class LineReader;
+
 bool challenge22(const std::vector<std::string_view>& input);
+bool challenge22Streaming(LineReader& input);
+
+namespace day22 {
+using SecretNumbers = std::vector<std::int64_t>;
+
+SecretNumbers generateSecretNumbers(std::int64_t secret) noexcept;
+} //namespace day22
 
 #endif //CHALLENGE22_HPP
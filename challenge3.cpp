@@ -1,16 +1,57 @@
 #include "challenge3.hpp"
 
 #include "helper.hpp"
+#include "linereader.hpp"
 #include "print.hpp"
 
 #include "3rdParty/ctre/include/ctre.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <optional>
 #include <ranges>
+#include <thread>
+#include <vector>
 
 using namespace std::string_view_literals;
 
 namespace {
+//Reads 1 to 3 digits, which have to be followed by terminator.
+std::optional<std::int64_t> readFactor(std::string_view text, std::size_t& position, char terminator) noexcept {
+    std::int64_t value  = 0;
+    std::size_t  digits = 0;
+    auto isDigit = [&text, &position](void) noexcept { return text[position] >= '0' && text[position] <= '9'; };
+    for ( ; position < text.size() && digits < 3 && isDigit(); ++position, ++digits ) {
+        value = value * 10 + (text[position] - '0');
+    } //for ( ; position < text.size() && digits < 3 && isDigit(); ++position, ++digits )
+
+    if ( digits == 0 || position == text.size() || text[position] != terminator ) {
+        return std::nullopt;
+    } //if ( digits == 0 || position == text.size() || text[position] != terminator )
+    ++position;
+    return value;
+}
+
+std::optional<std::int64_t> matchMul(std::string_view text) noexcept {
+    if ( !text.starts_with("mul("sv) ) {
+        return std::nullopt;
+    } //if ( !text.starts_with("mul("sv) )
+
+    std::size_t position = "mul("sv.size();
+    const auto  lhs      = readFactor(text, position, ',');
+    if ( !lhs ) {
+        return std::nullopt;
+    } //if ( !lhs )
+
+    const auto rhs = readFactor(text, position, ')');
+    if ( !rhs ) {
+        return std::nullopt;
+    } //if ( !rhs )
+    return *lhs * *rhs;
+}
+} //namespace
+
+namespace day3 {
 std::int64_t findMul(std::string_view text) noexcept {
     constexpr auto regEx = ctre::search_all<R"(mul\((\d{1,3}),(\d{1,3})\))">;
     auto mul = [](auto match) noexcept { return convert(match.template get<1>()) * convert(match.template get<2>()); };
@@ -33,19 +74,123 @@ std::int64_t findMulWithEnabled(std::string_view text, bool& enabled) noexcept {
         return enabled;
     };
     auto mul = [](auto match) noexcept { return convert(match.template get<2>()) * convert(match.template get<3>()); };
-    return std::ranges::fold_left(regEx(text) | std::views::filter(onlyEnabled) | std::views::transform(mul), 0, std::plus<>{});
+    return std::ranges::fold_left(regEx(text) | std::views::filter(onlyEnabled) | std::views::transform(mul), 0,
+                                  std::plus<>{});
+}
+
+void ScanState::append(const ChunkResult& chunk) noexcept {
+    Sum        += chunk.Sum;
+    EnabledSum += chunk.enabledSum(Enabled);
+    Enabled     = chunk.EndsEnabled.value_or(Enabled);
+    return;
+}
+
+ChunkResult scanChunk(std::string_view text, std::size_t begin, std::size_t end) noexcept {
+    ChunkResult ret;
+    if ( begin >= end ) {
+        return ret;
+    } //if ( begin >= end )
+
+    const auto textEnd  = text.data() + text.size();
+    const auto chunkEnd = text.data() + end;
+    auto       findNext = [chunkEnd](const char* from, char what) noexcept {
+        const auto found = std::memchr(from, what, static_cast<std::size_t>(chunkEnd - from));
+        return found ? static_cast<const char*>(found) : chunkEnd;
+    };
+
+    //Every match starts with an m or a d, the vectorized memchr jumps to the next candidates. Everything else is skipped
+    //without looking at it byte by byte.
+    auto nextM = findNext(text.data() + begin, 'm');
+    auto nextD = findNext(text.data() + begin, 'd');
+
+    while ( nextM != chunkEnd || nextD != chunkEnd ) {
+        if ( nextM < nextD ) {
+            if ( const auto product = matchMul({nextM, textEnd}) ) {
+                ret.Sum += *product;
+                if ( !ret.EndsEnabled ) {
+                    ret.BeforeFirstSwitch += *product;
+                } //if ( !ret.EndsEnabled )
+                else if ( *ret.EndsEnabled ) {
+                    ret.AfterFirstSwitch += *product;
+                } //else if ( *ret.EndsEnabled )
+            } //if ( const auto product = matchMul({nextM, textEnd}) )
+            nextM = findNext(nextM + 1, 'm');
+        } //if ( nextM < nextD )
+        else {
+            const std::string_view candidate{nextD, textEnd};
+            if ( candidate.starts_with("do()"sv) ) {
+                ret.EndsEnabled = true;
+            } //if ( candidate.starts_with("do()"sv) )
+            else if ( candidate.starts_with("don't()"sv) ) {
+                ret.EndsEnabled = false;
+            } //else if ( candidate.starts_with("don't()"sv) )
+            nextD = findNext(nextD + 1, 'd');
+        } //else -> if ( nextM < nextD )
+    } //while ( nextM != chunkEnd || nextD != chunkEnd )
+    return ret;
+}
+
+void scanMemory(std::string_view text, ScanState& state) noexcept {
+    state.append(scanChunk(text, 0, text.size()));
+    return;
+}
+
+void scanMemoryParallel(std::string_view text, ScanState& state, std::size_t numberOfChunks) {
+    numberOfChunks = std::clamp(numberOfChunks, 1zu, std::max(text.size(), 1zu));
+    auto chunkBegin = [&text, numberOfChunks](std::size_t chunk) noexcept {
+        return text.size() * chunk / numberOfChunks;
+    };
+
+    std::vector<ChunkResult> results(numberOfChunks);
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(numberOfChunks - 1);
+        for ( std::size_t chunk = 1; chunk < numberOfChunks; ++chunk ) {
+            threads.emplace_back([&results, &chunkBegin, text, chunk](void) noexcept {
+                results[chunk] = scanChunk(text, chunkBegin(chunk), chunkBegin(chunk + 1));
+                return;
+            });
+        } //for ( std::size_t chunk = 1; chunk < numberOfChunks; ++chunk )
+        results.front() = scanChunk(text, 0, chunkBegin(1));
+    } //Joins the threads.
+
+    //The state at the start of a chunk is only known after the previous ones, so combine them in order.
+    for ( const auto& result : results ) {
+        state.append(result);
+    } //for ( const auto& result : results )
+    return;
 }
-} //namespace
+
+void scanMemoryParallel(std::string_view text, ScanState& state) {
+    const auto cores = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    scanMemoryParallel(text, state, std::min(cores, text.size() / ParallelChunkSize));
+    return;
+}
+} //namespace day3
 
 bool challenge3(const std::vector<std::string_view>& input) {
-    const auto sum1 = std::ranges::fold_left(input | std::views::transform(findMul), 0, std::plus<>{});
+    day3::ScanState state;
+    for ( auto line : input ) {
+        day3::scanMemoryParallel(line, state);
+    } //for ( auto line : input )
 
+    const auto sum1 = state.Sum;
+    const auto sum2 = state.EnabledSum;
     myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+
+    return sum1 == 173419328 && sum2 == 90669332;
+}
 
-    bool       enabled = true;
-    const auto sum2    = std::ranges::fold_left(
-        input | std::views::transform([&enabled](auto text) noexcept { return findMulWithEnabled(text, enabled); }), 0,
-        std::plus<>{});
+bool challenge3Streaming(LineReader& input) {
+    day3::ScanState state;
+    while ( auto line = input.next() ) {
+        day3::scanMemoryParallel(*line, state);
+    } //while ( auto line = input.next() )
+
+    const auto sum1 = state.Sum;
+    const auto sum2 = state.EnabledSum;
+    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
     myPrint(" == Result of Part 2: {:d} ==\n", sum2);
 
     return sum1 == 173419328 && sum2 == 90669332;
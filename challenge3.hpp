@@ -1,9 +1,56 @@
 #ifndef CHALLENGE3_HPP
 #define CHALLENGE3_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <string_view>
 #include <vector>
 
+class LineReader;
+
 bool challenge3(const std::vector<std::string_view>& input);
+bool challenge3Streaming(LineReader& input);
+
+namespace day3 {
+//The reference implementation, based on ctre.
+std::int64_t findMul(std::string_view text) noexcept;
+std::int64_t findMulWithEnabled(std::string_view text, bool& enabled) noexcept;
+
+//The result of a part of the memory, for both possible states at its start.
+struct ChunkResult {
+    std::int64_t        Sum               = 0;
+    //Only enabled, if the chunk starts enabled.
+    std::int64_t        BeforeFirstSwitch = 0;
+    std::int64_t        AfterFirstSwitch  = 0;
+    //Unset, if there is no do() or don't() in the chunk.
+    std::optional<bool> EndsEnabled;
+
+    std::int64_t enabledSum(bool startsEnabled) const noexcept {
+        return (startsEnabled ? BeforeFirstSwitch : 0) + AfterFirstSwitch;
+    }
+};
+
+struct ScanState {
+    std::int64_t Sum        = 0;
+    std::int64_t EnabledSum = 0;
+    bool         Enabled    = true;
+
+    void append(const ChunkResult& chunk) noexcept;
+};
+
+//Scans the matches which start in [begin, end), they may extend beyond end.
+ChunkResult scanChunk(std::string_view text, std::size_t begin, std::size_t end) noexcept;
+
+//Finds mul(X,Y), do() and don't() in one pass and adds the results for both parts, the state carries over lines.
+void scanMemory(std::string_view text, ScanState& state) noexcept;
+
+constexpr std::size_t ParallelChunkSize = 1 << 20;
+
+//Splits text into numberOfChunks chunks at arbitrary offsets, scans them in parallel and combines the results.
+void scanMemoryParallel(std::string_view text, ScanState& state, std::size_t numberOfChunks);
+//Uses one chunk per core, but at least ParallelChunkSize bytes per chunk.
+void scanMemoryParallel(std::string_view text, ScanState& state);
+} //namespace day3
 
 #endif //CHALLENGE3_HPP
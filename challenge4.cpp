@@ -2,8 +2,10 @@
 
 #include "helper.hpp"
 #include "print.hpp"
+#include "specialize.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <ranges>
 
 using namespace std::string_view_literals;
@@ -468,34 +470,74 @@ std::int64_t count(const Input& input, std::string_view needle) noexcept {
         haystack = {found.end(), haystack.end()};
     } //while ( true )
 }
+
+//The needle is a compile time constant, so the comparison is unrolled and needs no second iterator over the needle.
+//Neither XMAS nor SAMX can overlap with itself, so this counts the same as the search above.
+template<FixedString Needle, typename Input>
+std::int64_t count(const Input& input) noexcept {
+    constexpr auto needleSize = static_cast<std::ptrdiff_t>(Needle.size());
+    const auto     size       = std::ranges::ssize(input);
+    const auto     begin      = std::ranges::begin(input);
+
+    auto matchesAt = [&begin]<std::size_t... Indices>(std::ptrdiff_t offset, std::index_sequence<Indices...>) noexcept {
+        return ((begin[offset + static_cast<std::ptrdiff_t>(Indices)] == Needle[Indices]) && ...);
+    };
+
+    std::int64_t ret = 0;
+    for ( std::ptrdiff_t offset = 0; offset + needleSize <= size; ++offset ) {
+        if ( matchesAt(offset, std::make_index_sequence<Needle.size()>{}) ) {
+            ++ret;
+        } //if ( matchesAt(offset, std::make_index_sequence<Needle.size()>{}) )
+    } //for ( std::ptrdiff_t offset = 0; offset + needleSize <= size; ++offset )
+    return ret;
+}
 } //namespace
 
-bool challenge4(const std::vector<std::string_view>& input) {
-    auto countXmas   = [](const auto& x) noexcept { return count(x, "XMAS"sv); };
-    auto countSamx   = [](const auto& x) noexcept { return count(x, "SAMX"sv); };
+namespace day4 {
+template<bool Specialized>
+std::int64_t countXmas(const std::vector<std::string_view>& input) noexcept {
+    auto countXmasIn = [](const auto& x) noexcept {
+        if constexpr ( Specialized ) {
+            return count<"XMAS">(x);
+        } //if constexpr ( Specialized )
+        else {
+            return count(x, "XMAS"sv);
+        } //else -> if constexpr ( Specialized )
+    };
+    auto countSamxIn = [](const auto& x) noexcept {
+        if constexpr ( Specialized ) {
+            return count<"SAMX">(x);
+        } //if constexpr ( Specialized )
+        else {
+            return count(x, "SAMX"sv);
+        } //else -> if constexpr ( Specialized )
+    };
 
-    auto leftToRight = std::ranges::fold_left(input | std::views::transform(countXmas), 0, std::plus<>{});
-    auto rightToLeft = std::ranges::fold_left(input | std::views::transform(countSamx), 0, std::plus<>{});
+    auto leftToRight = std::ranges::fold_left(input | std::views::transform(countXmasIn), 0, std::plus<>{});
+    auto rightToLeft = std::ranges::fold_left(input | std::views::transform(countSamxIn), 0, std::plus<>{});
 
     TransposedVector transposed{input};
 
-    auto topToBottom = std::ranges::fold_left(transposed | std::views::transform(countXmas), 0, std::plus<>{});
-    auto bottomToTop = std::ranges::fold_left(transposed | std::views::transform(countSamx), 0, std::plus<>{});
+    auto topToBottom = std::ranges::fold_left(transposed | std::views::transform(countXmasIn), 0, std::plus<>{});
+    auto bottomToTop = std::ranges::fold_left(transposed | std::views::transform(countSamxIn), 0, std::plus<>{});
 
     DiagonalVector<true>  diagonalRight{input};
     DiagonalVector<false> diagonalLeft{input};
 
-    auto downAndRight = std::ranges::fold_left(diagonalRight | std::views::transform(countXmas), 0, std::plus<>{});
-    auto upAndLeft    = std::ranges::fold_left(diagonalRight | std::views::transform(countSamx), 0, std::plus<>{});
+    auto downAndRight = std::ranges::fold_left(diagonalRight | std::views::transform(countXmasIn), 0, std::plus<>{});
+    auto upAndLeft    = std::ranges::fold_left(diagonalRight | std::views::transform(countSamxIn), 0, std::plus<>{});
 
-    auto downAndLeft  = std::ranges::fold_left(diagonalLeft | std::views::transform(countXmas), 0, std::plus<>{});
-    auto upAndRight   = std::ranges::fold_left(diagonalLeft | std::views::transform(countSamx), 0, std::plus<>{});
+    auto downAndLeft  = std::ranges::fold_left(diagonalLeft | std::views::transform(countXmasIn), 0, std::plus<>{});
+    auto upAndRight   = std::ranges::fold_left(diagonalLeft | std::views::transform(countSamxIn), 0, std::plus<>{});
 
-    const auto sum1 =
-        leftToRight + rightToLeft + topToBottom + bottomToTop + downAndRight + upAndLeft + downAndLeft + upAndRight;
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+    return leftToRight + rightToLeft + topToBottom + bottomToTop + downAndRight + upAndLeft + downAndLeft + upAndRight;
+}
 
-    auto countCrossMas = [&input](auto lineAndNumber) noexcept {
+template std::int64_t countXmas<false>(const std::vector<std::string_view>& input) noexcept;
+template std::int64_t countXmas<true>(const std::vector<std::string_view>& input) noexcept;
+
+std::int64_t countCrossMas(const std::vector<std::string_view>& input) noexcept {
+    auto countCrossMasIn = [&input](auto lineAndNumber) noexcept {
         auto [line, rowNumber] = lineAndNumber;
         auto isCross           = [&input, rowNumber](auto charAndColumn) noexcept {
             auto [c, columnNumber] = charAndColumn;
@@ -518,10 +560,95 @@ bool challenge4(const std::vector<std::string_view>& input) {
             std::views::zip(line | std::views::drop(1), std::views::iota(1zu, line.size() - 1)), isCross);
     };
 
-    const auto sum2 =
-        std::ranges::fold_left(std::views::zip(input | std::views::drop(1), std::views::iota(1zu, input.size() - 1)) |
-                                   std::views::transform(countCrossMas),
-                               0, std::plus<>{});
+    return std::ranges::fold_left(
+        std::views::zip(input | std::views::drop(1), std::views::iota(1zu, input.size() - 1)) |
+            std::views::transform(countCrossMasIn),
+        0, std::plus<>{});
+}
+
+LetterBoards::LetterBoards(const std::vector<std::string_view>& input) :
+        Rows{input.size()}, Columns{input.empty() ? 0 : input.front().size()}, Words{(Columns + 63) / 64} {
+    for ( auto& board : Boards ) {
+        board.resize(Rows * Words);
+    } //for ( auto& board : Boards )
+
+    for ( std::size_t row = 0; row < Rows; ++row ) {
+        throwIfInvalid(input[row].size() == Columns);
+        for ( std::size_t column = 0; column < Columns; ++column ) {
+            const auto letter = "XMAS"sv.find(input[row][column]);
+            if ( letter != std::string_view::npos ) {
+                Boards[letter][row * Words + column / 64] |= std::uint64_t{1} << (column % 64);
+            } //if ( letter != std::string_view::npos )
+        } //for ( std::size_t column = 0; column < Columns; ++column )
+    } //for ( std::size_t row = 0; row < Rows; ++row )
+    return;
+}
+
+std::int64_t LetterBoards::countXmas(void) const noexcept {
+    return countXmasIn<0, 1>() + countXmasIn<0, -1>() + countXmasIn<1, 0>() + countXmasIn<-1, 0>() +
+           countXmasIn<1, 1>() + countXmasIn<1, -1>() + countXmasIn<-1, 1>() + countXmasIn<-1, -1>();
+}
+
+std::int64_t LetterBoards::countCrossMas(void) const noexcept {
+    std::int64_t ret = 0;
+    for ( std::size_t row = 1; row + 1 < Rows; ++row ) {
+        for ( std::size_t word = 0; word < Words; ++word ) {
+            //Both diagonals through the A have to be MAS or SAM.
+            const auto falling = (shifted<M, -1>(row - 1, word) & shifted<S, 1>(row + 1, word)) |
+                                 (shifted<S, -1>(row - 1, word) & shifted<M, 1>(row + 1, word));
+            const auto rising  = (shifted<M, 1>(row - 1, word) & shifted<S, -1>(row + 1, word)) |
+                                (shifted<S, 1>(row - 1, word) & shifted<M, -1>(row + 1, word));
+            ret += std::popcount(shifted<A, 0>(row, word) & falling & rising);
+        } //for ( std::size_t word = 0; word < Words; ++word )
+    } //for ( std::size_t row = 1; row + 1 < Rows; ++row )
+    return ret;
+}
+
+template<std::size_t Letter, int Offset>
+std::uint64_t LetterBoards::shifted(std::size_t row, std::size_t word) const noexcept {
+    const auto at = [this, row](std::size_t index) noexcept { return Boards[Letter][row * Words + index]; };
+
+    if constexpr ( Offset > 0 ) {
+        const auto high = word + 1 < Words ? at(word + 1) << (64 - Offset) : 0;
+        return at(word) >> Offset | high;
+    } //if constexpr ( Offset > 0 )
+    else if constexpr ( Offset < 0 ) {
+        const auto low = word > 0 ? at(word - 1) >> (64 + Offset) : 0;
+        return at(word) << -Offset | low;
+    } //else if constexpr ( Offset < 0 )
+    else {
+        return at(word);
+    } //else -> if constexpr ( Offset > 0 )
+}
+
+template<int RowStep, int ColumnStep>
+std::int64_t LetterBoards::countXmasIn(void) const noexcept {
+    //The rows in which the word can start, so that it does not leave the grid.
+    const std::size_t firstRow = RowStep < 0 ? 3 : 0;
+    const std::size_t endRow   = RowStep > 0 ? std::max(Rows, 3zu) - 3 : Rows;
+    const auto        rowAfter = [](std::size_t row, int steps) noexcept {
+        return static_cast<std::size_t>(static_cast<std::ptrdiff_t>(row) + RowStep * steps);
+    };
+
+    std::int64_t ret = 0;
+    for ( auto row = firstRow; row < endRow; ++row ) {
+        for ( std::size_t word = 0; word < Words; ++word ) {
+            ret += std::popcount(shifted<X, 0>(row, word) & shifted<M, ColumnStep>(rowAfter(row, 1), word) &
+                                 shifted<A, 2 * ColumnStep>(rowAfter(row, 2), word) &
+                                 shifted<S, 3 * ColumnStep>(rowAfter(row, 3), word));
+        } //for ( std::size_t word = 0; word < Words; ++word )
+    } //for ( auto row = firstRow; row < endRow; ++row )
+    return ret;
+}
+} //namespace day4
+
+bool challenge4(const std::vector<std::string_view>& input) {
+    const day4::LetterBoards boards{input};
+
+    const auto sum1 = boards.countXmas();
+    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+
+    const auto sum2 = boards.countCrossMas();
     myPrint(" == Result of Part 2: {:d} ==\n", sum2);
 
     return sum1 == 2557 && sum2 == 1854;
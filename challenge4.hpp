@@ -1,9 +1,47 @@
 #ifndef CHALLENGE4_HPP
 #define CHALLENGE4_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
 bool challenge4(const std::vector<std::string_view>& input);
 
+namespace day4 {
+//Counts XMAS in all 8 directions, Specialized selects the needle as template argument over the std::ranges::search.
+template<bool Specialized>
+std::int64_t countXmas(const std::vector<std::string_view>& input) noexcept;
+std::int64_t countCrossMas(const std::vector<std::string_view>& input) noexcept;
+
+//The grid as one bitboard per letter, bit c of word w of a row is set if the letter is in column 64 * w + c. A
+//direction is checked for 64 columns at once, by shifting the rows of the following letters and ANDing them.
+class LetterBoards {
+    public:
+    explicit LetterBoards(const std::vector<std::string_view>& input);
+
+    std::int64_t countXmas(void) const noexcept;
+    std::int64_t countCrossMas(void) const noexcept;
+
+    private:
+    static constexpr std::size_t X = 0;
+    static constexpr std::size_t M = 1;
+    static constexpr std::size_t A = 2;
+    static constexpr std::size_t S = 3;
+
+    std::size_t                               Rows;
+    std::size_t                               Columns;
+    std::size_t                               Words;
+    std::array<std::vector<std::uint64_t>, 4> Boards;
+
+    //The word of the row, with bit c holding column 64 * word + c + Offset.
+    template<std::size_t Letter, int Offset>
+    std::uint64_t shifted(std::size_t row, std::size_t word) const noexcept;
+
+    template<int RowStep, int ColumnStep>
+    std::int64_t countXmasIn(void) const noexcept;
+};
+} //namespace day4
+
 #endif //CHALLENGE4_HPP
@@ -4,97 +4,171 @@
 #include "print.hpp"
 
 #include <algorithm>
-#include <functional>
 #include <iterator>
 #include <numeric>
 #include <ranges>
+#include <stdexcept>
 #include <string_view>
-#include <unordered_map>
 #include <unordered_set>
 
-namespace {
-using Update = std::vector<std::int64_t>;
+namespace day5 {
+void PrecedenceMatrix::add(std::int64_t before, std::int64_t after) {
+    throwIfInvalid(before >= 0 && before < static_cast<std::int64_t>(Pages));
+    throwIfInvalid(after >= 0 && after < static_cast<std::int64_t>(Pages));
+    Predecessors[static_cast<std::size_t>(after)].set(static_cast<std::size_t>(before));
+    return;
+}
 
-struct Data {
-    std::unordered_multimap<std::int64_t, std::int64_t> ReverseOrderings;
-    std::vector<Update>                                 Updates;
-};
+bool PrecedenceMatrix::isCorrectlyOrdered(std::span<const std::int64_t> update) const noexcept {
+    //All pages which would have to be printed before an already printed one.
+    std::bitset<Pages> tooLate;
+    for ( auto page : update ) {
+        const auto index = static_cast<std::size_t>(page);
+        if ( tooLate.test(index) ) {
+            return false;
+        } //if ( tooLate.test(index) )
+        tooLate |= Predecessors[index];
+    } //for ( auto page : update )
+    return true;
+}
 
-Data parse(const std::vector<std::string_view>& input) noexcept {
-    auto toReverseOrdering = [](std::string_view line) noexcept {
-        auto pipe = line.find('|');
-        return std::pair{convert(line.substr(pipe + 1)), convert(line.substr(0, pipe))};
-    };
+std::int64_t PrecedenceMatrix::correctedMiddle(std::span<std::int64_t> update) const noexcept {
+    const auto middle = std::next(update.begin(), static_cast<std::ptrdiff_t>((update.size() - 1) / 2));
+    std::ranges::nth_element(update, middle, [this](std::int64_t lhs, std::int64_t rhs) noexcept {
+        return mustPrecede(lhs, rhs);
+    });
+    return *middle;
+}
+
+void OrderingEngine::addRule(std::int64_t before, std::int64_t after) {
+    Rules.add(before, after);
+    Orderings.clear();
+    return;
+}
+
+bool OrderingEngine::isCorrectlyOrdered(std::span<const std::int64_t> update) const noexcept {
+    return Rules.isCorrectlyOrdered(update);
+}
+
+std::span<const std::int64_t> OrderingEngine::correctOrder(std::span<const std::int64_t> update) {
+    return orderingFor(update);
+}
+
+const std::vector<std::int64_t>& OrderingEngine::orderingFor(std::span<const std::int64_t> update) {
+    PageSet pages;
+    for ( auto page : update ) {
+        pages.set(static_cast<std::size_t>(page));
+    } //for ( auto page : update )
+    throwIfInvalid(pages.count() == update.size(), "Page printed twice");
+
+    auto [iter, inserted] = Orderings.try_emplace(pages);
+    if ( !inserted ) {
+        return iter->second;
+    } //if ( !inserted )
+
+    //Kahn's algorithm: the next page is the first remaining one of the update, which has no remaining predecessor. So
+    //pages which the rules do not order keep the order of the update.
+    auto& ordering = iter->second;
+    ordering.reserve(update.size());
+    for ( auto remaining = pages; remaining.any(); ) {
+        const auto next = std::ranges::find_if(update, [this, &remaining](std::int64_t page) noexcept {
+            return remaining.test(static_cast<std::size_t>(page)) && (Rules.predecessors(page) & remaining).none();
+        });
+
+        if ( next == update.end() ) {
+            Orderings.erase(iter);
+            throw std::runtime_error{"The rules contain a cycle"};
+        } //if ( next == update.end() )
+        ordering.push_back(*next);
+        remaining.reset(static_cast<std::size_t>(*next));
+    } //for ( auto remaining = pages; remaining.any(); )
+    return ordering;
+}
 
+Data parse(const std::vector<std::string_view>& input) {
     auto toUpdate = [](std::string_view line) noexcept {
         return splitString(line, ',') | std::views::transform(&convert<10>) | std::ranges::to<std::vector>();
     };
 
-    Data      ret;
-    std::span span          = input;
-    auto      orderingInput = span | std::views::take_while(std::not_fn(&std::string_view::empty));
-    auto result = std::ranges::transform(orderingInput, std::inserter(ret.ReverseOrderings, ret.ReverseOrderings.end()),
-                                         toReverseOrdering);
-    span        = std::span{std::next(result.in), span.end()};
-    ret.Updates.resize(span.size());
-    std::ranges::transform(span, ret.Updates.begin(), toUpdate);
-
+    Data ret;
+    auto line = input.begin();
+    for ( ; line != input.end() && !line->empty(); ++line ) {
+        const auto pipe   = line->find('|');
+        const auto before = convert(line->substr(0, pipe));
+        const auto after  = convert(line->substr(pipe + 1));
+        ret.ReverseOrderings.emplace(after, before);
+        ret.Precedences.add(before, after);
+    } //for ( ; line != input.end() && !line->empty(); ++line )
+
+    if ( line != input.end() ) {
+        ++line;
+    } //if ( line != input.end() )
+    ret.Updates.resize(static_cast<std::size_t>(std::distance(line, input.end())));
+    std::ranges::transform(line, input.end(), ret.Updates.begin(), toUpdate);
+    throwIfInvalid(std::ranges::all_of(ret.Updates | std::views::join, [](std::int64_t page) noexcept {
+        return page >= 0 && page < static_cast<std::int64_t>(PrecedenceMatrix::Pages);
+    }));
     return ret;
 }
-} //namespace
 
-bool challenge5(const std::vector<std::string_view>& input) {
-    auto data               = parse(input);
-
-    auto isCorrectlyOrdered = [&data](const Update& update) noexcept {
-        std::unordered_set<std::int64_t> alreadyPrinted;
-        alreadyPrinted.reserve(update.size());
-        return std::ranges::all_of(update | std::views::reverse, [&alreadyPrinted, &data](std::int64_t page) noexcept {
-            const auto pagesToComeBeforeThis      = data.ReverseOrderings.equal_range(page);
-            const auto orderingConstraintViolated = std::ranges::any_of(
-                std::ranges::subrange{pagesToComeBeforeThis.first, pagesToComeBeforeThis.second} | std::views::values,
-                [&alreadyPrinted](std::int64_t pageToComeBefore) { return alreadyPrinted.contains(pageToComeBefore); });
-
-            if ( orderingConstraintViolated ) {
-                return false;
-            } //if ( orderingConstraintViolated )
-
-            alreadyPrinted.insert(page);
-            return true;
-        });
-    };
+bool isCorrectlyOrdered(const Data& data, const Update& update) noexcept {
+    std::unordered_set<std::int64_t> alreadyPrinted;
+    alreadyPrinted.reserve(update.size());
+    return std::ranges::all_of(update | std::views::reverse, [&alreadyPrinted, &data](std::int64_t page) noexcept {
+        const auto pagesToComeBeforeThis      = data.ReverseOrderings.equal_range(page);
+        const auto orderingConstraintViolated = std::ranges::any_of(
+            std::ranges::subrange{pagesToComeBeforeThis.first, pagesToComeBeforeThis.second} | std::views::values,
+            [&alreadyPrinted](std::int64_t pageToComeBefore) { return alreadyPrinted.contains(pageToComeBefore); });
+
+        if ( orderingConstraintViolated ) {
+            return false;
+        } //if ( orderingConstraintViolated )
+
+        alreadyPrinted.insert(page);
+        return true;
+    });
+}
 
-    auto midPoint = [](const Update& update) noexcept {
-        return *std::midpoint(std::addressof(update.front()), std::addressof(update.back()));
-    };
+Update& bringToCorrectOrder(const Data& data, Update& update) noexcept {
+    auto begin = update.begin();
+    auto end   = update.end();
+    for ( auto i = begin; i != end; ) {
+        auto                  page       = *i;
+        auto                  equalRange = data.ReverseOrderings.equal_range(page);
+        std::ranges::subrange pagesToComeBefore{equalRange.first, equalRange.second};
+        auto j = std::ranges::find_if(std::next(i), end, [pagesToComeBefore](std::int64_t afterPage) noexcept {
+            return std::ranges::contains(pagesToComeBefore | std::views::values, afterPage);
+        });
+        if ( j == end ) {
+            ++i;
+        } //if ( j == end )
+        else {
+            std::ranges::iter_swap(i, j);
+        } //else -> if ( j == end )
+    } //for ( auto i = begin; i != end; )
+    return update;
+}
 
-    auto sum1 = std::ranges::fold_left(
-        data.Updates | std::views::filter(isCorrectlyOrdered) | std::views::transform(midPoint), 0, std::plus<>{});
-    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+std::int64_t midPoint(std::span<const std::int64_t> update) noexcept {
+    return *std::midpoint(std::addressof(update.front()), std::addressof(update.back()));
+}
+} //namespace day5
 
-    auto bringToCorrectOrder = [&data](Update& update) noexcept {
-        auto begin = update.begin();
-        auto end   = update.end();
-        for ( auto i = begin; i != end; ) {
-            auto page = *i;
-            auto                  equalRange = data.ReverseOrderings.equal_range(page);
-            std::ranges::subrange pagesToComeBefore{equalRange.first, equalRange.second};
-            auto j = std::ranges::find_if(std::next(i), end, [pagesToComeBefore](std::int64_t afterPage) noexcept {
-                return std::ranges::contains(pagesToComeBefore | std::views::values, afterPage);
-            });
-            if ( j == end ) {
-                ++i;
-            } //if ( j == end )
-            else {
-                std::ranges::iter_swap(i, j);
-            } //else -> if ( j == end )
-        } //for ( auto i = update.rbegin(); i != end; )
-        return update;
-    };
+bool challenge5(const std::vector<std::string_view>& input) {
+    auto data = day5::parse(input);
+
+    std::int64_t sum1 = 0;
+    std::int64_t sum2 = 0;
+    for ( auto& update : data.Updates ) {
+        if ( data.Precedences.isCorrectlyOrdered(update) ) {
+            sum1 += day5::midPoint(update);
+        } //if ( data.Precedences.isCorrectlyOrdered(update) )
+        else {
+            sum2 += data.Precedences.correctedMiddle(update);
+        } //else -> if ( data.Precedences.isCorrectlyOrdered(update) )
+    } //for ( auto& update : data.Updates )
 
-    auto sum2 = std::ranges::fold_left(data.Updates | std::views::filter(std::not_fn(isCorrectlyOrdered)) |
-                                           std::views::transform(bringToCorrectOrder) | std::views::transform(midPoint),
-                                       0, std::plus<>{});
+    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
     myPrint(" == Result of Part 2: {:d} ==\n", sum2);
 
     return sum1 == 5391 && sum2 == 6142;
@@ -1,9 +1,89 @@
 #ifndef CHALLENGE5_HPP
 #define CHALLENGE5_HPP
 
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 bool challenge5(const std::vector<std::string_view>& input);
 
+namespace day5 {
+using Update = std::vector<std::int64_t>;
+
+//The rules as a bit matrix over the two digit page numbers, ordering checks are bit tests and need no allocation.
+class PrecedenceMatrix {
+    public:
+    static constexpr std::size_t Pages = 100;
+
+    void add(std::int64_t before, std::int64_t after);
+
+    bool mustPrecede(std::int64_t before, std::int64_t after) const noexcept {
+        return Predecessors[static_cast<std::size_t>(after)].test(static_cast<std::size_t>(before));
+    }
+
+    //The pages which have to be printed before the page.
+    const std::bitset<Pages>& predecessors(std::int64_t page) const noexcept {
+        return Predecessors[static_cast<std::size_t>(page)];
+    }
+
+    bool isCorrectlyOrdered(std::span<const std::int64_t> update) const noexcept;
+    //Reorders the update only as far as needed to determine its middle page, which is returned. The rules have to
+    //define a total order on the pages of the update, as they do for the puzzle input.
+    std::int64_t correctedMiddle(std::span<std::int64_t> update) const noexcept;
+
+    private:
+    std::array<std::bitset<Pages>, Pages> Predecessors{};
+};
+
+//Keeps the rules and caches a correct order for every set of pages it has repaired, so an update with a known page set
+//is repaired by copying the cached order. The order of a set is computed once, by topologically sorting the pages on
+//the rules restricted to the set, so a rule may also hold transitively through other pages of the set. The rules only
+//have to be a partial order on the set, only a cycle throws. Changing the rules drops the cache.
+class OrderingEngine {
+    public:
+    explicit OrderingEngine(const PrecedenceMatrix& rules) : Rules{rules} {
+        return;
+    }
+
+    void addRule(std::int64_t before, std::int64_t after);
+
+    //No page has a predecessor later in the update.
+    bool isCorrectlyOrdered(std::span<const std::int64_t> update) const noexcept;
+    //The pages of the update in a correct order, valid until the rules are changed. If the rules do not order some
+    //pages, it is one of the correct orders, the same for every update with the same pages.
+    std::span<const std::int64_t> correctOrder(std::span<const std::int64_t> update);
+
+    std::size_t cachedOrderings(void) const noexcept {
+        return Orderings.size();
+    }
+
+    private:
+    using PageSet = std::bitset<PrecedenceMatrix::Pages>;
+
+    PrecedenceMatrix                                       Rules;
+    std::unordered_map<PageSet, std::vector<std::int64_t>> Orderings;
+
+    const std::vector<std::int64_t>& orderingFor(std::span<const std::int64_t> update);
+};
+
+struct Data {
+    std::unordered_multimap<std::int64_t, std::int64_t> ReverseOrderings;
+    PrecedenceMatrix                                    Precedences;
+    std::vector<Update>                                 Updates;
+};
+
+Data parse(const std::vector<std::string_view>& input);
+
+//The reference implementation, on the map of the rules.
+bool    isCorrectlyOrdered(const Data& data, const Update& update) noexcept;
+Update& bringToCorrectOrder(const Data& data, Update& update) noexcept;
+
+std::int64_t midPoint(std::span<const std::int64_t> update) noexcept;
+} //namespace day5
+
 #endif //CHALLENGE5_HPP
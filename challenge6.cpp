@@ -1,14 +1,40 @@
 #include "challenge6.hpp"
 
-#include "helper.hpp"
 #include "print.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <optional>
+#include <span>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 
 namespace {
-using Position = Coordinate<std::int64_t>;
+using day6::Position;
 
+Direction& operator|=(Direction& lhs, Direction rhs) noexcept {
+    reinterpret_cast<std::underlying_type_t<Direction>&>(lhs) |= std::to_underlying(rhs);
+    return lhs;
+}
+
+bool operator&(Direction lhs, Direction rhs) noexcept {
+    return std::to_underlying(lhs) & std::to_underlying(rhs);
+}
+
+std::size_t directionIndex(Direction direction) noexcept {
+    return static_cast<std::size_t>(std::countr_zero(static_cast<unsigned int>(std::to_underlying(direction))));
+}
+
+CoordinateOffset<std::int64_t> stepOf(Direction direction) noexcept {
+    const Position origin{0, 0};
+    return origin.moved(direction) - origin;
+}
+} //namespace
+
+namespace day6 {
 Position findStart(MapView map) noexcept {
     Position::MaxRow    = static_cast<std::int64_t>(map.Base.size());
     Position::MaxColumn = static_cast<std::int64_t>(map.Base.front().size());
@@ -23,7 +49,7 @@ Position findStart(MapView map) noexcept {
     return {};
 }
 
-auto moveFromMap(MapView map, Position currentPosition) noexcept {
+std::size_t moveFromMap(MapView map, Position currentPosition) noexcept {
     Direction                    direction = Direction::Up;
     std::unordered_set<Position> visited;
 
@@ -40,16 +66,7 @@ auto moveFromMap(MapView map, Position currentPosition) noexcept {
     return visited.size();
 }
 
-Direction& operator|=(Direction& lhs, Direction rhs) noexcept {
-    reinterpret_cast<std::underlying_type_t<Direction>&>(lhs) |= std::to_underlying(rhs);
-    return lhs;
-}
-
-bool operator&(Direction lhs, Direction rhs) noexcept {
-    return std::to_underlying(lhs) & std::to_underlying(rhs);
-}
-
-auto findObstaclesForLoop(MapView map, const Position startPosition) noexcept {
+std::int64_t findObstaclesForLoop(MapView map, const Position startPosition) noexcept {
     std::unordered_map<Position, Direction> moved;
     Direction                               direction       = Direction::Up;
     std::int64_t                            obstacleCount   = 0;
@@ -91,15 +108,231 @@ auto findObstaclesForLoop(MapView map, const Position startPosition) noexcept {
     } //while ( currentPosition.isValid() )
     return obstacleCount;
 }
-} //namespace
+
+StopTracker::StopTracker(std::size_t cells) : Stamps(cells), Directions(cells) {
+    return;
+}
+
+void StopTracker::reset(void) noexcept {
+    if ( ++Generation == 0 ) {
+        //After the wrap around old stamps could look current again.
+        std::ranges::fill(Stamps, 0);
+        Generation = 1;
+    } //if ( ++Generation == 0 )
+    return;
+}
+
+bool StopTracker::mark(std::size_t cell, Direction direction) noexcept {
+    if ( Stamps[cell] != Generation ) {
+        Stamps[cell]     = Generation;
+        Directions[cell] = 0;
+    } //if ( Stamps[cell] != Generation )
+
+    const auto bit = static_cast<std::uint8_t>(std::to_underlying(direction));
+    if ( Directions[cell] & bit ) {
+        return false;
+    } //if ( Directions[cell] & bit )
+    Directions[cell] |= bit;
+    return true;
+}
+
+PatrolMap::PatrolMap(const std::vector<std::string_view>& map) :
+        Rows{std::ssize(map)}, Columns{map.empty() ? 0 : std::ssize(map.front())} {
+    throwIfInvalid(Rows > 0 && Columns > 0);
+    throwIfInvalid(Rows * Columns < static_cast<std::int64_t>(Exit));
+    throwIfInvalid(std::ranges::all_of(map, [this](std::string_view row) noexcept {
+        return std::ssize(row) == Columns;
+    }));
+
+    Obstacles.resize(static_cast<std::size_t>(Rows * Columns));
+    std::optional<Position> start;
+    for ( std::int64_t row = 0; row < Rows; ++row ) {
+        for ( std::int64_t column = 0; column < Columns; ++column ) {
+            const Position position{row, column};
+            switch ( MapView{map}[position] ) {
+                case '#' : Obstacles[toIndex(position)] = true; break;
+                case '^' : start = position; break;
+                default  : break;
+            } //switch ( MapView{map}[position] )
+        } //for ( std::int64_t column = 0; column < Columns; ++column )
+    } //for ( std::int64_t row = 0; row < Rows; ++row )
+    throwIfInvalid(start.has_value(), "No guard on the map");
+    Start = *start;
+
+    //Walk every row and column against the direction, so the last seen obstacle is the next one in the direction.
+    auto fill = [this](Direction direction, Position first, CoordinateOffset<std::int64_t> along) {
+        auto& stops = Stops[directionIndex(direction)];
+        auto  stop  = Exit;
+        for ( auto position = first; isInside(position); position += along ) {
+            if ( Obstacles[toIndex(position)] ) {
+                stop = toIndex(position + along);
+            } //if ( Obstacles[toIndex(position)] )
+            else {
+                stops[toIndex(position)] = stop;
+            } //else -> if ( Obstacles[toIndex(position)] )
+        } //for ( auto position = first; isInside(position); position += along )
+        return;
+    };
+
+    for ( auto& stops : Stops ) {
+        stops.assign(static_cast<std::size_t>(Rows * Columns), Exit);
+    } //for ( auto& stops : Stops )
+
+    for ( std::int64_t row = 0; row < Rows; ++row ) {
+        fill(Direction::Left, {row, 0}, {0, 1});
+        fill(Direction::Right, {row, Columns - 1}, {0, -1});
+    } //for ( std::int64_t row = 0; row < Rows; ++row )
+
+    for ( std::int64_t column = 0; column < Columns; ++column ) {
+        fill(Direction::Up, {0, column}, {1, 0});
+        fill(Direction::Down, {Rows - 1, column}, {-1, 0});
+    } //for ( std::int64_t column = 0; column < Columns; ++column )
+    return;
+}
+
+std::int64_t PatrolMap::countVisited(void) const {
+    std::vector<bool> visited(Obstacles.size());
+    std::int64_t      ret       = 0;
+    auto              position  = Start;
+    auto              direction = Direction::Up;
+
+    for ( ;; direction = turnRight(direction) ) {
+        const auto stop = Stops[directionIndex(direction)][toIndex(position)];
+        const auto step = stepOf(direction);
+        for ( ;; position += step ) {
+            if ( !visited[toIndex(position)] ) {
+                visited[toIndex(position)] = true;
+                ++ret;
+            } //if ( !visited[toIndex(position)] )
+
+            if ( toIndex(position) == stop || !isInside(position + step) ) {
+                break;
+            } //if ( toIndex(position) == stop || !isInside(position + step) )
+        } //for ( ;; position += step )
+
+        if ( stop == Exit ) {
+            return ret;
+        } //if ( stop == Exit )
+    } //for ( ;; direction = turnRight(direction) )
+}
+
+std::int64_t PatrolMap::countLoopObstacles(std::size_t numberOfThreads) const {
+    const auto candidates = loopCandidates();
+    numberOfThreads       = std::clamp(numberOfThreads, 1zu, std::max(candidates.size(), 1zu));
+
+    //Every thread checks a contiguous range of the candidates with its own tracker.
+    auto countRange = [this, &candidates, numberOfThreads](std::size_t thread) {
+        const auto   begin = candidates.size() * thread / numberOfThreads;
+        const auto   end   = candidates.size() * (thread + 1) / numberOfThreads;
+        StopTracker  stops{cells()};
+        std::int64_t ret = 0;
+        for ( const auto& candidate : std::span{candidates}.subspan(begin, end - begin) ) {
+            if ( loopsWith(candidate.From, candidate.Facing, candidate.Obstacle, stops) ) {
+                ++ret;
+            } //if ( loopsWith(candidate.From, candidate.Facing, candidate.Obstacle, stops) )
+        } //for ( const auto& candidate : std::span{candidates}.subspan(begin, end - begin) )
+        return ret;
+    };
+
+    std::vector<std::int64_t> counts(numberOfThreads);
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(numberOfThreads - 1);
+        for ( std::size_t thread = 1; thread < numberOfThreads; ++thread ) {
+            threads.emplace_back([&counts, &countRange, thread](void) {
+                counts[thread] = countRange(thread);
+                return;
+            });
+        } //for ( std::size_t thread = 1; thread < numberOfThreads; ++thread )
+        counts.front() = countRange(0);
+    } //Joins the threads.
+    return std::ranges::fold_left(counts, std::int64_t{0}, std::plus<>{});
+}
+
+std::int64_t PatrolMap::countLoopObstacles(void) const {
+    const auto cores = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    //The path is at most as long as the map is large, a cheap upper bound for the number of candidates.
+    return countLoopObstacles(std::min(cores, std::max(cells() / CandidatesPerThread, 1zu)));
+}
+
+std::vector<PatrolMap::Candidate> PatrolMap::loopCandidates(void) const {
+    //Every cell of the path is a candidate when the guard reaches it the first time, an obstacle later on would change
+    //the path before.
+    std::vector<Candidate> ret;
+    std::vector<bool>      visited(Obstacles.size());
+    auto                   position  = Start;
+    auto                   direction = Direction::Up;
+
+    visited[toIndex(position)] = true;
+    for ( ;; ) {
+        const auto next = position + stepOf(direction);
+        if ( !isInside(next) ) {
+            return ret;
+        } //if ( !isInside(next) )
+
+        if ( Obstacles[toIndex(next)] ) {
+            direction = turnRight(direction);
+            continue;
+        } //if ( Obstacles[toIndex(next)] )
+
+        if ( !visited[toIndex(next)] ) {
+            visited[toIndex(next)] = true;
+            ret.push_back({position, direction, next});
+        } //if ( !visited[toIndex(next)] )
+        position = next;
+    } //for ( ;; )
+}
+
+bool PatrolMap::loopsWith(Position position, Direction direction, Position obstacle,
+                          StopTracker& stops) const noexcept {
+    //The guard loops, if it stops at the same place facing the same direction twice.
+    stops.reset();
+    for ( ;; direction = turnRight(direction) ) {
+        const auto stop = stopFrom(position, direction, obstacle);
+        if ( stop == Exit ) {
+            return false;
+        } //if ( stop == Exit )
+
+        if ( !stops.mark(stop, direction) ) {
+            return true;
+        } //if ( !stops.mark(stop, direction) )
+        position = toPosition(stop);
+    } //for ( ;; direction = turnRight(direction) )
+}
+
+PatrolMap::Index PatrolMap::stopFrom(Position position, Direction direction, Position obstacle) const noexcept {
+    const auto stop = Stops[directionIndex(direction)][toIndex(position)];
+
+    //The additional obstacle is only relevant, if it is in the line of sight, and not behind the next obstacle.
+    const auto step   = stepOf(direction);
+    const auto offset = obstacle - position;
+    const auto inLine = step.Row == 0 ? offset.Row == 0 : offset.Column == 0;
+    if ( !inLine ) {
+        return stop;
+    } //if ( !inLine )
+
+    const auto distance = offset.Row * step.Row + offset.Column * step.Column;
+    if ( distance <= 0 ) {
+        return stop;
+    } //if ( distance <= 0 )
+
+    if ( stop != Exit ) {
+        const auto toStop = toPosition(stop) - position;
+        if ( toStop.Row * step.Row + toStop.Column * step.Column < distance ) {
+            return stop;
+        } //if ( toStop.Row * step.Row + toStop.Column * step.Column < distance )
+    } //if ( stop != Exit )
+    return toIndex(obstacle + step * -1);
+}
+} //namespace day6
 
 bool challenge6(const std::vector<std::string_view>& input) {
-    const auto startPosition = findStart(input);
-    const auto visitedFields = moveFromMap(input, startPosition);
+    const day6::PatrolMap map{input};
+    const auto            visitedFields = map.countVisited();
 
     myPrint(" == Result of Part 1: {:d} ==\n", visitedFields);
 
-    const auto obstacles = findObstaclesForLoop(input, startPosition);
+    const auto obstacles = map.countLoopObstacles();
     myPrint(" == Result of Part 2: {:d} ==\n", obstacles);
 
     return visitedFields == 5239 && obstacles == 1753;
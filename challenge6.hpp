@@ -1,9 +1,104 @@
 #ifndef CHALLENGE6_HPP
 #define CHALLENGE6_HPP
 
+#include "helper.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
 bool challenge6(const std::vector<std::string_view>& input);
 
+namespace day6 {
+using Position = Coordinate<std::int64_t>;
+
+//The reference implementation, walking cell by cell. findStart sets the bounds of Position.
+Position     findStart(MapView map) noexcept;
+std::size_t  moveFromMap(MapView map, Position currentPosition) noexcept;
+std::int64_t findObstaclesForLoop(MapView map, Position startPosition) noexcept;
+
+constexpr std::size_t CandidatesPerThread = 2'048;
+
+//The directions in which the guard stopped at every cell, reused for all loop checks without any allocation. A new
+//check only increments the generation, a cell with an older stamp counts as never visited.
+class StopTracker {
+    public:
+    explicit StopTracker(std::size_t cells);
+
+    void reset(void) noexcept;
+    //Returns false, if the guard already stopped at the cell facing the direction.
+    bool mark(std::size_t cell, Direction direction) noexcept;
+
+    private:
+    std::vector<std::uint32_t> Stamps;
+    std::vector<std::uint8_t>  Directions;
+    std::uint32_t              Generation = 0;
+};
+
+//The map with a table of the next obstacle for every cell and direction, so the guard moves segment by segment from
+//turn to turn. An additional obstacle only shortens the segment which runs into it.
+class PatrolMap {
+    public:
+    explicit PatrolMap(const std::vector<std::string_view>& map);
+
+    std::int64_t countVisited(void) const;
+    //The number of positions, where an obstacle would trap the guard in a loop. The path is recorded first, then the
+    //candidates are checked on numberOfThreads threads.
+    std::int64_t countLoopObstacles(std::size_t numberOfThreads) const;
+    //Uses one thread per core, but at most one per CandidatesPerThread cells of the map.
+    std::int64_t countLoopObstacles(void) const;
+
+    std::size_t cells(void) const noexcept {
+        return Obstacles.size();
+    }
+
+    //Whether the guard, standing at position and facing direction, runs into a loop, with an additional obstacle.
+    bool loopsWith(Position position, Direction direction, Position obstacle, StopTracker& stops) const noexcept;
+
+    bool guardLeaves(void) const {
+        //An obstacle outside of the map changes nothing.
+        StopTracker stops{cells()};
+        return !loopsWith(Start, Direction::Up, {-1, -1}, stops);
+    }
+
+    private:
+    using Index = std::uint32_t;
+
+    static constexpr Index Exit = static_cast<Index>(-1);
+
+    //The guard at From, facing an additional obstacle.
+    struct Candidate {
+        Position  From;
+        Direction Facing;
+        Position  Obstacle;
+    };
+
+    std::int64_t      Rows;
+    std::int64_t      Columns;
+    Position          Start;
+    std::vector<bool> Obstacles;
+    //For every direction (see directionIndex) and cell, the cell in front of the next obstacle, or Exit.
+    std::array<std::vector<Index>, 4> Stops;
+
+    bool isInside(Position position) const noexcept {
+        return position.Row >= 0 && position.Row < Rows && position.Column >= 0 && position.Column < Columns;
+    }
+
+    Index toIndex(Position position) const noexcept {
+        return static_cast<Index>(position.Row * Columns + position.Column);
+    }
+
+    Position toPosition(Index index) const noexcept {
+        return {static_cast<std::int64_t>(index) / Columns, static_cast<std::int64_t>(index) % Columns};
+    }
+
+    std::vector<Candidate> loopCandidates(void) const;
+
+    //Where the guard stops, in front of the next obstacle, or Exit if the guard leaves the map.
+    Index stopFrom(Position position, Direction direction, Position obstacle) const noexcept;
+};
+} //namespace day6
+
 #endif //CHALLENGE6_HPP
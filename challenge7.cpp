@@ -1,27 +1,58 @@
 #include "challenge7.hpp"
 
 #include "helper.hpp"
+#include "linereader.hpp"
 #include "print.hpp"
+#include "specialize.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <ranges>
+#include <thread>
+
+using day7::Equation;
 
 namespace {
-struct Equation {
-    std::vector<std::int64_t> Operands;
-    std::int64_t              Result;
-};
-
-auto parse(const std::vector<std::string_view>& input) {
-    auto toEquation = [](std::string_view line) {
-        Equation ret;
-        auto     colon = line.find(':');
-        ret.Result     = convert(line.substr(0, colon));
-        ret.Operands   = splitString(line.substr(colon + 1), ' ') | std::views::transform(convert<10>) |
-                       std::ranges::to<std::vector>();
+Equation toEquation(std::string_view line) {
+    Equation ret;
+    auto     colon = line.find(':');
+    ret.Result     = convert(line.substr(0, colon));
+    ret.Operands   = splitString(line.substr(colon + 1), ' ') | std::views::transform(convert<10>) |
+                   std::ranges::to<std::vector>();
+    throwIfInvalid(std::ranges::all_of(ret.Operands, [](std::int64_t operand) noexcept { return operand >= 0; }),
+                   "Negative operand");
+    return ret;
+}
+
+//The smallest power of 10 which is greater than value, 0 has one digit like the other single digits.
+std::int64_t powerOfTenAbove(const std::int64_t value) noexcept {
+    static constexpr auto logTable = [](void) noexcept {
+        std::array<std::int64_t, 12> ret;
+        ret[0] = 1;
+        std::ranges::generate(ret | std::views::drop(1), [log = std::int64_t{1}](void) mutable noexcept {
+            log *= 10;
+            return log;
+        });
         return ret;
-    };
-    return input | std::views::transform(toEquation) | std::ranges::to<std::vector>();
+    }();
+    return *std::ranges::upper_bound(logTable, std::max<std::int64_t>(value, 1));
+}
+
+std::int64_t concatenate(const std::int64_t lhs, const std::int64_t rhs) noexcept {
+    return lhs * powerOfTenAbove(rhs) + rhs;
+}
+
+template<bool WithConcatenation>
+bool isEquationValidImpl(std::int64_t expectedResult, std::int64_t resultSoFar,
+                         std::span<const std::int64_t> remainingOperands) noexcept;
+
+//The result so far is too big, every operator keeps it at least as big, except a multiplication by 0. That is done at
+//the next 0, a later one is still reachable from there. So the values never grow far beyond the expected result.
+template<bool WithConcatenation>
+bool multiplyByNextZero(const std::int64_t expectedResult, std::span<const std::int64_t> remainingOperands) noexcept {
+    const auto zero = std::ranges::find(remainingOperands, 0);
+    return zero != remainingOperands.end() &&
+           isEquationValidImpl<WithConcatenation>(expectedResult, 0, {std::next(zero), remainingOperands.end()});
 }
 
 template<bool WithConcatenation>
@@ -32,26 +63,16 @@ bool isEquationValidImpl(const std::int64_t expectedResult, const std::int64_t r
     } //if ( remainingOperands.empty() )
 
     if ( resultSoFar > expectedResult ) {
-        return false;
+        return multiplyByNextZero<WithConcatenation>(expectedResult, remainingOperands);
     } //if ( resultSoFar > expectedResult )
 
     const auto front  = remainingOperands.front();
     remainingOperands = remainingOperands.subspan(1);
 
     if constexpr ( WithConcatenation ) {
-        static constexpr auto logTable = [](void) noexcept {
-            std::array<std::int64_t, 12> ret;
-            ret[0] = 1;
-            std::ranges::generate(ret | std::views::drop(1), [log = std::int64_t{1}](void) mutable noexcept {
-                log *= 10;
-                return log;
-            });
-            return ret;
-        }();
-        const auto log = std::ranges::upper_bound(logTable, front);
-        if ( isEquationValidImpl<true>(expectedResult, resultSoFar * *log + front, remainingOperands) ) {
+        if ( isEquationValidImpl<true>(expectedResult, concatenate(resultSoFar, front), remainingOperands) ) {
             return true;
-        } //if ( isEquationValidImpl<true>(expectedResult, resultSoFar * *log + front, remainingOperands) )
+        } //if ( isEquationValidImpl<true>(expectedResult, concatenate(resultSoFar, front), remainingOperands) )
     } //if constexpr ( WithConcatenation )
 
     if ( isEquationValidImpl<WithConcatenation>(expectedResult, resultSoFar + front, remainingOperands) ) {
@@ -61,23 +82,213 @@ bool isEquationValidImpl(const std::int64_t expectedResult, const std::int64_t r
     return isEquationValidImpl<WithConcatenation>(expectedResult, resultSoFar * front, remainingOperands);
 }
 
+//Same as isEquationValidImpl, but with the operand count as constant the recursion is fully unrolled.
+template<bool WithConcatenation, std::size_t RemainingOperands>
+bool isEquationValidFixed(const std::int64_t expectedResult, const std::int64_t resultSoFar,
+                          const std::int64_t* remainingOperands) noexcept {
+    if constexpr ( RemainingOperands == 0 ) {
+        return expectedResult == resultSoFar;
+    } //if constexpr ( RemainingOperands == 0 )
+    else {
+        if ( resultSoFar > expectedResult ) {
+            return multiplyByNextZero<WithConcatenation>(expectedResult, {remainingOperands, RemainingOperands});
+        } //if ( resultSoFar > expectedResult )
+
+        const auto front = *remainingOperands;
+        const auto next  = remainingOperands + 1;
+
+        if constexpr ( WithConcatenation ) {
+            if ( isEquationValidFixed<true, RemainingOperands - 1>(expectedResult, concatenate(resultSoFar, front),
+                                                                    next) ) {
+                return true;
+            } //if ( isEquationValidFixed<true, RemainingOperands - 1>(concatenate(resultSoFar, front)) )
+        } //if constexpr ( WithConcatenation )
+
+        if ( isEquationValidFixed<WithConcatenation, RemainingOperands - 1>(expectedResult, resultSoFar + front,
+                                                                             next) ) {
+            return true;
+        } //if ( isEquationValidFixed<WithConcatenation, RemainingOperands - 1>(resultSoFar + front) )
+
+        return isEquationValidFixed<WithConcatenation, RemainingOperands - 1>(expectedResult, resultSoFar * front,
+                                                                              next);
+    } //else -> if constexpr ( RemainingOperands == 0 )
+}
+
+//Undoes the last operator: remainingOperands without the last one have to yield expectedResult.
+template<bool WithConcatenation>
+bool isEquationValidBackwards(const std::int64_t            expectedResult,
+                              std::span<const std::int64_t> remainingOperands) noexcept {
+    const auto last = remainingOperands.back();
+    if ( remainingOperands.size() == 1 ) {
+        return expectedResult == last;
+    } //if ( remainingOperands.size() == 1 )
+    remainingOperands = remainingOperands.first(remainingOperands.size() - 1);
+
+    //Whatever the other operands yield, times 0 it is 0. Checked first, because for a result of 0 undoing the
+    //concatenation or the addition of the 0 would search the same again.
+    if ( last == 0 && expectedResult == 0 ) {
+        return true;
+    } //if ( last == 0 && expectedResult == 0 )
+
+    if constexpr ( WithConcatenation ) {
+        const auto power = powerOfTenAbove(last);
+        if ( expectedResult % power == last &&
+             isEquationValidBackwards<true>(expectedResult / power, remainingOperands) ) {
+            return true;
+        } //if ( expectedResult % power == last && ... )
+    } //if constexpr ( WithConcatenation )
+
+    if ( last != 0 && expectedResult % last == 0 &&
+         isEquationValidBackwards<WithConcatenation>(expectedResult / last, remainingOperands) ) {
+        return true;
+    } //if ( last != 0 && expectedResult % last == 0 && ... )
+
+    return expectedResult >= last &&
+           isEquationValidBackwards<WithConcatenation>(expectedResult - last, remainingOperands);
+}
+} //namespace
+
+namespace day7 {
+std::vector<Equation> parse(const std::vector<std::string_view>& input) {
+    return input | std::views::transform(toEquation) | std::ranges::to<std::vector>();
+}
+
 template<bool WithConcatenation>
 bool isEquationValid(const Equation& equation) noexcept {
+    const auto remainingOperands = std::span{equation.Operands}.subspan(1);
+    return dispatch<1zu, 2zu, 3zu, 4zu, 5zu, 6zu, 7zu, 8zu, 9zu, 10zu, 11zu>(
+        remainingOperands.size(),
+        [&equation, remainingOperands]<std::size_t RemainingOperands>(void) noexcept {
+            return isEquationValidFixed<WithConcatenation, RemainingOperands>(
+                equation.Result, equation.Operands.front(), remainingOperands.data());
+        },
+        [&equation, remainingOperands](void) noexcept {
+            return isEquationValidImpl<WithConcatenation>(equation.Result, equation.Operands.front(),
+                                                          remainingOperands);
+        });
+}
+
+template<bool WithConcatenation>
+bool isEquationValidGeneric(const Equation& equation) noexcept {
     return isEquationValidImpl<WithConcatenation>(equation.Result, equation.Operands.front(),
                                                   std::span{equation.Operands}.subspan(1));
 }
-} //namespace
+
+template<bool WithConcatenation>
+bool isEquationValidReverse(const std::int64_t result, std::span<const std::int64_t> operands) noexcept {
+    return !operands.empty() && isEquationValidBackwards<WithConcatenation>(result, operands);
+}
+
+void EquationBatch::add(std::string_view line) {
+    const auto colon = line.find(':');
+    Results.push_back(convert(line.substr(0, colon)));
+    std::ranges::transform(splitString(line.substr(colon + 1), ' '), std::back_inserter(Operands), convert<10>);
+    throwIfInvalid(std::ranges::all_of(std::span{Operands}.subspan(Offsets.back()),
+                                       [](std::int64_t operand) noexcept { return operand >= 0; }),
+                   "Negative operand");
+    Offsets.push_back(Operands.size());
+    return;
+}
+
+EquationBatch parseBatch(const std::vector<std::string_view>& input) {
+    EquationBatch ret;
+    ret.Results.reserve(input.size());
+    ret.Offsets.reserve(input.size() + 1);
+    for ( auto line : input ) {
+        if ( !line.empty() ) {
+            ret.add(line);
+        } //if ( !line.empty() )
+    } //for ( auto line : input )
+    return ret;
+}
+
+CalibrationSums sumValid(const EquationBatch& batch, std::size_t begin, std::size_t end) noexcept {
+    CalibrationSums ret;
+    for ( auto equation = begin; equation < end; ++equation ) {
+        const auto result   = batch.Results[equation];
+        const auto operands = batch.operands(equation);
+        if ( isEquationValidReverse<false>(result, operands) ) {
+            ret.Total                  += result;
+            ret.TotalWithConcatenation += result;
+        } //if ( isEquationValidReverse<false>(result, operands) )
+        else if ( isEquationValidReverse<true>(result, operands) ) {
+            ret.TotalWithConcatenation += result;
+        } //else if ( isEquationValidReverse<true>(result, operands) )
+    } //for ( auto equation = begin; equation < end; ++equation )
+    return ret;
+}
+
+CalibrationSums sumValidParallel(const EquationBatch& batch, std::size_t numberOfThreads) {
+    numberOfThreads = std::clamp(numberOfThreads, 1zu, std::max(batch.size(), 1zu));
+    auto rangeBegin = [&batch, numberOfThreads](std::size_t thread) noexcept {
+        return batch.size() * thread / numberOfThreads;
+    };
+
+    std::vector<CalibrationSums> results(numberOfThreads);
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(numberOfThreads - 1);
+        for ( std::size_t thread = 1; thread < numberOfThreads; ++thread ) {
+            threads.emplace_back([&results, &batch, &rangeBegin, thread](void) noexcept {
+                results[thread] = sumValid(batch, rangeBegin(thread), rangeBegin(thread + 1));
+                return;
+            });
+        } //for ( std::size_t thread = 1; thread < numberOfThreads; ++thread )
+        results.front() = sumValid(batch, 0, rangeBegin(1));
+    } //Joins the threads.
+
+    CalibrationSums ret;
+    for ( const auto& result : results ) {
+        ret.Total                  += result.Total;
+        ret.TotalWithConcatenation += result.TotalWithConcatenation;
+    } //for ( const auto& result : results )
+    return ret;
+}
+
+CalibrationSums sumValidParallel(const EquationBatch& batch) {
+    const auto cores = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    return sumValidParallel(batch, std::min(cores, batch.size() / ParallelEquations));
+}
+
+template bool isEquationValid<false>(const Equation& equation) noexcept;
+template bool isEquationValid<true>(const Equation& equation) noexcept;
+template bool isEquationValidGeneric<false>(const Equation& equation) noexcept;
+template bool isEquationValidGeneric<true>(const Equation& equation) noexcept;
+template bool isEquationValidReverse<false>(std::int64_t result, std::span<const std::int64_t> operands) noexcept;
+template bool isEquationValidReverse<true>(std::int64_t result, std::span<const std::int64_t> operands) noexcept;
+} //namespace day7
 
 bool challenge7(const std::vector<std::string_view>& input) {
-    auto equations = parse(input);
-    const auto sum1      = std::ranges::fold_left(equations | std::views::filter(isEquationValid<false>) |
-                                                      std::views::transform(&Equation::Result),
-                                                  0, std::plus<>{});
+    const auto batch = day7::parseBatch(input);
+    const auto sums  = day7::sumValidParallel(batch);
+    const auto sum1  = sums.Total;
+    const auto sum2  = sums.TotalWithConcatenation;
     myPrint(" == Result of Part 1: {:d} ==\n", sum1);
+    myPrint(" == Result of Part 2: {:d} ==\n", sum2);
+
+    return sum1 == 6'083'020'304'036 && sum2 == 59'002'246'504'791;
+}
 
-    const auto sum2      = std::ranges::fold_left(equations | std::views::filter(isEquationValid<true>) |
-                                                 std::views::transform(&Equation::Result),
-                                             0, std::plus<>{});
+bool challenge7Streaming(LineReader& input) {
+    std::int64_t sum1 = 0;
+    std::int64_t sum2 = 0;
+
+    while ( auto line = input.next() ) {
+        if ( line->empty() ) {
+            continue;
+        } //if ( line->empty() )
+
+        const auto equation = toEquation(*line);
+        if ( day7::isEquationValidReverse<false>(equation.Result, equation.Operands) ) {
+            sum1 += equation.Result;
+            sum2 += equation.Result;
+        } //if ( day7::isEquationValidReverse<false>(equation.Result, equation.Operands) )
+        else if ( day7::isEquationValidReverse<true>(equation.Result, equation.Operands) ) {
+            sum2 += equation.Result;
+        } //else if ( day7::isEquationValidReverse<true>(equation.Result, equation.Operands) )
+    } //while ( auto line = input.next() )
+
+    myPrint(" == Result of Part 1: {:d} ==\n", sum1);
     myPrint(" == Result of Part 2: {:d} ==\n", sum2);
 
     return sum1 == 6'083'020'304'036 && sum2 == 59'002'246'504'791;
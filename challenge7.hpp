@@ -1,9 +1,74 @@
 #ifndef CHALLENGE7_HPP
 #define CHALLENGE7_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string_view>
 #include <vector>
 
+class LineReader;
+
 bool challenge7(const std::vector<std::string_view>& input);
+bool challenge7Streaming(LineReader& input);
+
+namespace day7 {
+struct Equation {
+    std::vector<std::int64_t> Operands;
+    std::int64_t              Result;
+};
+
+std::vector<Equation> parse(const std::vector<std::string_view>& input);
+
+//Dispatches to a search specialized for the operand count.
+template<bool WithConcatenation>
+bool isEquationValid(const Equation& equation) noexcept;
+
+//The search over a span, for any operand count.
+template<bool WithConcatenation>
+bool isEquationValidGeneric(const Equation& equation) noexcept;
+
+//Searches backwards from the result, undoing the operators from the last operand on. Subtracting only while the result
+//stays non-negative, dividing only without a remainder and removing only a matching decimal suffix cut nearly every
+//branch, so it handles far more operands than the forward search. The operands must not be negative.
+template<bool WithConcatenation>
+bool isEquationValidReverse(std::int64_t result, std::span<const std::int64_t> operands) noexcept;
+
+//All equations with the operands in one buffer, the operands of equation i are the ones from Offsets[i] to
+//Offsets[i + 1].
+struct EquationBatch {
+    std::vector<std::int64_t> Results;
+    std::vector<std::int64_t> Operands;
+    std::vector<std::size_t>  Offsets{0};
+
+    void add(std::string_view line);
+
+    std::size_t size(void) const noexcept {
+        return Results.size();
+    }
+
+    std::span<const std::int64_t> operands(std::size_t equation) const noexcept {
+        return std::span{Operands}.subspan(Offsets[equation], Offsets[equation + 1] - Offsets[equation]);
+    }
+};
+
+EquationBatch parseBatch(const std::vector<std::string_view>& input);
+
+struct CalibrationSums {
+    std::int64_t Total                  = 0;
+    std::int64_t TotalWithConcatenation = 0;
+};
+
+//Both parts in one pass over the equations [begin, end): an equation which is valid without concatenation is also
+//valid with it, only the others are searched a second time.
+CalibrationSums sumValid(const EquationBatch& batch, std::size_t begin, std::size_t end) noexcept;
+
+constexpr std::size_t ParallelEquations = 1'024;
+
+//Splits the equations into numberOfThreads contiguous ranges and sums them in parallel.
+CalibrationSums sumValidParallel(const EquationBatch& batch, std::size_t numberOfThreads);
+//Uses one thread per core, but at least ParallelEquations equations per thread.
+CalibrationSums sumValidParallel(const EquationBatch& batch);
+} //namespace day7
 
 #endif //CHALLENGE7_HPP
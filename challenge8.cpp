@@ -1,19 +1,34 @@
 #include "challenge8.hpp"
 
-#include "helper.hpp"
 #include "print.hpp"
 
 #include <algorithm>
+#include <numeric>
+#include <optional>
 #include <ranges>
-#include <unordered_map>
 #include <unordered_set>
 
 namespace {
-using Position = Coordinate<std::int64_t>;
+using day8::Position;
 
-auto findAntennas(MapView map) {
+std::optional<std::size_t> frequencyIndex(char antenna) noexcept {
+    if ( antenna >= '0' && antenna <= '9' ) {
+        return static_cast<std::size_t>(antenna - '0');
+    } //if ( antenna >= '0' && antenna <= '9' )
+    if ( antenna >= 'A' && antenna <= 'Z' ) {
+        return static_cast<std::size_t>(antenna - 'A' + 10);
+    } //if ( antenna >= 'A' && antenna <= 'Z' )
+    if ( antenna >= 'a' && antenna <= 'z' ) {
+        return static_cast<std::size_t>(antenna - 'a' + 36);
+    } //if ( antenna >= 'a' && antenna <= 'z' )
+    return std::nullopt;
+}
+} //namespace
+
+namespace day8 {
+Antennas findAntennas(MapView map) {
     Position::setMaxFromMap(map);
-    std::unordered_map<char, std::vector<Position>> antennas;
+    Antennas antennas;
     std::ranges::for_each(std::views::cartesian_product(std::views::iota(0LL, Position::MaxRow),
                                                         std::views::iota(0LL, Position::MaxColumn)) |
                               std::views::transform([](auto rowAndColumn) noexcept {
@@ -29,26 +44,28 @@ auto findAntennas(MapView map) {
     return antennas;
 }
 
-auto findAntinodes(MapView map, const std::unordered_map<char, std::vector<Position>>& antennas) noexcept {
+std::size_t countAntinodes(const Antennas& antennas) {
     std::unordered_set<Position> antinodes;
-    for ( const auto& [antennaType, positions] : antennas ) {
-        //This tries to add the position of the antennas (but they are filtered out).
+    for ( const auto& positions : antennas | std::views::values ) {
+        //The product also pairs every antenna with itself, which is no pair.
         std::ranges::copy(std::views::cartesian_product(positions, positions) |
+                              std::views::filter([](auto bothPositions) noexcept {
+                                  auto [first, second] = bothPositions;
+                                  return first != second;
+                              }) |
                               std::views::transform([](auto bothPositions) noexcept {
                                   auto [first, second] = bothPositions;
                                   return first + (second - first) * 2;
                               }) |
-                              std::views::filter([&map, antennaType](Position pos) noexcept {
-                                  return pos.isValid() && map[pos] != antennaType;
-                              }),
+                              std::views::filter([](Position pos) noexcept { return pos.isValid(); }),
                           std::inserter(antinodes, antinodes.end()));
-    } //for ( const auto& [antennaType, positions] : antennas )
-    return antinodes;
+    } //for ( const auto& positions : antennas | std::views::values )
+    return antinodes.size();
 }
 
-auto findResonantAntinodes(const std::unordered_map<char, std::vector<Position>>& antennas) noexcept {
+std::size_t countResonantAntinodes(const Antennas& antennas) {
     std::unordered_set<Position> antinodes;
-    for ( const auto& [antennaType, positions] : antennas ) {
+    for ( const auto& positions : antennas | std::views::values ) {
         if ( positions.size() == 1 ) {
             continue;
         } //if ( positions.size() == 1 )
@@ -57,12 +74,14 @@ auto findResonantAntinodes(const std::unordered_map<char, std::vector<Position>>
             antinodes.insert(position);
 
             for ( auto nextPosition : positions | std::views::drop(index + 1) ) {
-                auto offset = nextPosition - position;
+                auto       offset  = nextPosition - position;
+                const auto divisor = std::gcd(offset.Row, offset.Column);
+                offset             = {offset.Row / divisor, offset.Column / divisor};
 
-                for ( auto positionToCheck  = nextPosition + offset; positionToCheck.isValid();
+                for ( auto positionToCheck  = position + offset; positionToCheck.isValid();
                       positionToCheck      += offset ) {
                     antinodes.insert(positionToCheck);
-                } //for ( auto positionToCheck  = nextPosition + offset; positionToCheck.isValid(); += offset )
+                } //for ( auto positionToCheck  = position + offset; positionToCheck.isValid(); += offset )
 
                 offset *= -1;
                 for ( auto positionToCheck = position + offset; positionToCheck.isValid(); positionToCheck += offset ) {
@@ -70,19 +89,96 @@ auto findResonantAntinodes(const std::unordered_map<char, std::vector<Position>>
                 } //for ( auto positionToCheck  = position + offset; positionToCheck.isValid(); += offset )
             } //for ( auto nextPosition : positions | std::views::drop(index + 1) )
         } //for ( auto [index, position] : std::views::enumerate(positions) )
-    } //for ( const auto& [antennaType, positions] : antennas )
-    return antinodes;
+    } //for ( const auto& positions : antennas | std::views::values )
+    return antinodes.size();
 }
-} //namespace
+
+AntennaMap::AntennaMap(const std::vector<std::string_view>& map) :
+        Rows{std::ssize(map)}, Columns{map.empty() ? 0 : std::ssize(map.front())} {
+    throwIfInvalid(std::ranges::all_of(map, [this](std::string_view row) noexcept {
+        return std::ssize(row) == Columns;
+    }));
+
+    for ( std::int64_t row = 0; row < Rows; ++row ) {
+        for ( std::int64_t column = 0; column < Columns; ++column ) {
+            const Position position{row, column};
+            const auto     antenna = MapView{map}[position];
+            if ( antenna == '.' ) {
+                continue;
+            } //if ( antenna == '.' )
+
+            const auto frequency = frequencyIndex(antenna);
+            throwIfInvalid(frequency.has_value(), "Invalid antenna");
+            ByFrequency[*frequency].push_back(position);
+        } //for ( std::int64_t column = 0; column < Columns; ++column )
+    } //for ( std::int64_t row = 0; row < Rows; ++row )
+    return;
+}
+
+template<typename MarkPair>
+std::int64_t AntennaMap::countMarked(MarkPair&& markPair) const {
+    std::vector<bool> marked(static_cast<std::size_t>(Rows * Columns));
+    std::int64_t      ret  = 0;
+    auto              mark = [this, &marked, &ret](Position position) noexcept {
+        if ( !isInside(position) ) {
+            return false;
+        } //if ( !isInside(position) )
+
+        const auto index = static_cast<std::size_t>(position.Row * Columns + position.Column);
+        if ( !marked[index] ) {
+            marked[index] = true;
+            ++ret;
+        } //if ( !marked[index] )
+        return true;
+    };
+
+    for ( const auto& positions : ByFrequency ) {
+        for ( std::size_t first = 0; first < positions.size(); ++first ) {
+            for ( std::size_t second = first + 1; second < positions.size(); ++second ) {
+                markPair(positions[first], positions[second], mark);
+            } //for ( std::size_t second = first + 1; second < positions.size(); ++second )
+        } //for ( std::size_t first = 0; first < positions.size(); ++first )
+    } //for ( const auto& positions : ByFrequency )
+    return ret;
+}
+
+std::int64_t AntennaMap::countAntinodes(void) const {
+    return countMarked([](Position first, Position second, auto& mark) noexcept {
+        const auto offset = second - first;
+        mark(second + offset);
+        mark(first + offset * -1);
+        return;
+    });
+}
+
+std::int64_t AntennaMap::countResonantAntinodes(void) const {
+    return countMarked([](Position first, Position second, auto& mark) noexcept {
+        auto       offset  = second - first;
+        const auto divisor = std::gcd(offset.Row, offset.Column);
+        offset             = {offset.Row / divisor, offset.Column / divisor};
+
+        auto markRay = [&mark](Position position, CoordinateOffset<std::int64_t> step) noexcept {
+            while ( mark(position) ) {
+                position += step;
+            } //while ( mark(position) )
+            return;
+        };
+
+        //The antennas themselves are on the line.
+        markRay(first, offset);
+        markRay(first + offset * -1, offset * -1);
+        return;
+    });
+}
+} //namespace day8
 
 bool challenge8(const std::vector<std::string_view>& input) {
-    const auto antennas          = findAntennas(input);
-    const auto antinodes         = findAntinodes(input, antennas);
-    const auto numberOfAntinodes = antinodes.size();
+    const day8::AntennaMap map{input};
+    const auto             numberOfAntinodes = map.countAntinodes();
 
     myPrint(" == Result of Part 1: {:d} ==\n", numberOfAntinodes);
 
-    const auto numberOfResonantAntinodes = findResonantAntinodes(antennas).size();
+    const auto numberOfResonantAntinodes = map.countResonantAntinodes();
     myPrint(" == Result of Part 2: {:d} ==\n", numberOfResonantAntinodes);
 
     return numberOfAntinodes == 273 && numberOfResonantAntinodes == 1017;
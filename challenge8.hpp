@@ -1,9 +1,52 @@
 #ifndef CHALLENGE8_HPP
 #define CHALLENGE8_HPP
 
+#include "helper.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 bool challenge8(const std::vector<std::string_view>& input);
 
+namespace day8 {
+using Position = Coordinate<std::int64_t>;
+using Antennas = std::unordered_map<char, std::vector<Position>>;
+
+//The reference implementation, on hash containers. findAntennas sets the bounds of Position.
+Antennas    findAntennas(MapView map);
+std::size_t countAntinodes(const Antennas& antennas);
+std::size_t countResonantAntinodes(const Antennas& antennas);
+
+//The antennas in one array per frequency, the antinodes are marked in a bit per cell, so duplicates cost nothing.
+class AntennaMap {
+    public:
+    explicit AntennaMap(const std::vector<std::string_view>& map);
+
+    std::int64_t countAntinodes(void) const;
+    //Every position in line with two antennas, the offset is reduced by the gcd so no position in between is missed.
+    std::int64_t countResonantAntinodes(void) const;
+
+    private:
+    //The digits and the upper and lower case letters.
+    static constexpr std::size_t Frequencies = 62;
+
+    std::int64_t                                   Rows;
+    std::int64_t                                   Columns;
+    std::array<std::vector<Position>, Frequencies> ByFrequency;
+
+    bool isInside(Position position) const noexcept {
+        return position.Row >= 0 && position.Row < Rows && position.Column >= 0 && position.Column < Columns;
+    }
+
+    //Calls markPair(first, second, mark) for every pair of antennas with the same frequency, mark(position) returns
+    //false if the position is outside of the map. Returns the number of marked positions.
+    template<typename MarkPair>
+    std::int64_t countMarked(MarkPair&& markPair) const;
+};
+} //namespace day8
+
 #endif //CHALLENGE8_HPP
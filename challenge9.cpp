@@ -4,14 +4,13 @@
 #include "print.hpp"
 
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <iterator>
+#include <queue>
 #include <ranges>
 
-namespace {
-using FileBlock               = std::int16_t;
-
-constexpr FileBlock FreeBlock = -1;
-
+namespace day9 {
 std::vector<FileBlock> parse(std::string_view input) noexcept {
     std::vector<FileBlock> fileBlocks;
     fileBlocks.resize(input.size() * 9, FreeBlock); //Upper bound
@@ -126,17 +125,109 @@ std::int64_t moveFilesAndBuildCheckSum(std::vector<FileBlock>& fileBlocks) {
         }),
         0LL, std::plus<>{});
 }
-} //namespace
+
+std::int64_t compactBlocks(std::string_view diskMap) {
+    throwIfInvalid(std::ranges::all_of(diskMap, [](char digit) noexcept { return digit >= '0' && digit <= '9'; }));
+    if ( diskMap.empty() ) {
+        return 0;
+    } //if ( diskMap.empty() )
+
+    auto sizeAt = [diskMap](std::size_t index) noexcept { return static_cast<std::int64_t>(diskMap[index] - '0'); };
+    //The sum of id * p for p in [position, position + size).
+    auto series = [](std::size_t index, std::int64_t position, std::int64_t size) noexcept {
+        return static_cast<std::int64_t>(index / 2) * (size * position + size * (size - 1) / 2);
+    };
+
+    //The back index is always on a file, with backRemaining blocks of it not yet moved.
+    std::size_t  front         = 0;
+    std::size_t  back          = (diskMap.size() - 1) & ~1zu;
+    std::int64_t backRemaining = sizeAt(back);
+    std::int64_t position      = 0;
+    std::int64_t checkSum      = 0;
+
+    for ( ; front <= back; ++front ) {
+        if ( front % 2 == 0 ) {
+            const auto size  = front == back ? backRemaining : sizeAt(front);
+            checkSum        += series(front, position, size);
+            position        += size;
+            continue;
+        } //if ( front % 2 == 0 )
+
+        for ( auto gap = sizeAt(front); gap > 0 && back > front; ) {
+            const auto moved  = std::min(gap, backRemaining);
+            checkSum         += series(back, position, moved);
+            position         += moved;
+            gap              -= moved;
+            backRemaining    -= moved;
+            if ( backRemaining == 0 ) {
+                back          -= 2;
+                backRemaining  = sizeAt(back);
+            } //if ( backRemaining == 0 )
+        } //for ( auto gap = sizeAt(front); gap > 0 && back > front; )
+    } //for ( ; front <= back; ++front )
+    return checkSum;
+}
+
+std::int64_t compactFiles(std::string_view diskMap) {
+    struct File {
+        std::int64_t Start;
+        std::int64_t Size;
+    };
+
+    using GapHeap = std::priority_queue<std::int64_t, std::vector<std::int64_t>, std::greater<>>;
+
+    std::vector<File>       files;
+    std::array<GapHeap, 10> gaps;
+    files.reserve(diskMap.size() / 2 + 1);
+
+    std::int64_t position = 0;
+    for ( std::size_t index = 0; index < diskMap.size(); ++index ) {
+        const auto size = static_cast<std::int64_t>(diskMap[index] - '0');
+        throwIfInvalid(size >= 0 && size <= 9);
+        if ( index % 2 == 0 ) {
+            files.push_back({position, size});
+        } //if ( index % 2 == 0 )
+        else if ( size > 0 ) {
+            gaps[static_cast<std::size_t>(size)].push(position);
+        } //else if ( size > 0 )
+        position += size;
+    } //for ( std::size_t index = 0; index < diskMap.size(); ++index )
+
+    std::int64_t checkSum = 0;
+    for ( auto id = std::ssize(files) - 1; id >= 0; --id ) {
+        auto& file = files[static_cast<std::size_t>(id)];
+
+        //Only gaps left of the file count. The gaps the moved files leave behind are right of all remaining files.
+        std::size_t bestSize = 0;
+        for ( auto size = static_cast<std::size_t>(std::max<std::int64_t>(file.Size, 1)); size < gaps.size(); ++size ) {
+            if ( !gaps[size].empty() && gaps[size].top() < file.Start &&
+                 (bestSize == 0 || gaps[size].top() < gaps[bestSize].top()) ) {
+                bestSize = size;
+            } //if ( !gaps[size].empty() && ... )
+        } //for ( auto size = ...; size < gaps.size(); ++size )
+
+        if ( bestSize != 0 && file.Size > 0 ) {
+            file.Start = gaps[bestSize].top();
+            gaps[bestSize].pop();
+            if ( const auto rest = bestSize - static_cast<std::size_t>(file.Size); rest > 0 ) {
+                gaps[rest].push(file.Start + file.Size);
+            } //if ( const auto rest = bestSize - static_cast<std::size_t>(file.Size); rest > 0 )
+        } //if ( bestSize != 0 && file.Size > 0 )
+
+        //The sum of the positions Start, Start + 1, ..., Start + Size - 1.
+        checkSum += id * (file.Size * file.Start + file.Size * (file.Size - 1) / 2);
+    } //for ( auto id = std::ssize(files) - 1; id >= 0; --id )
+    return checkSum;
+}
+} //namespace day9
 
 bool challenge9(const std::vector<std::string_view>& input) {
     throwIfInvalid(input.size() == 1);
-    auto fileBlocks = parse(input.front());
-
-    const auto sum1 = moveFileBlocksAndBuildCheckSum(fileBlocks);
+    const auto sum1 = day9::compactBlocks(input.front());
 
     myPrint(" == Result of Part 1: {:d} ==\n", sum1);
 
-    const auto sum2 = moveFilesAndBuildCheckSum(fileBlocks);
+    const auto sum2 = day9::compactFiles(input.front());
 
     myPrint(" == Result of Part 2: {:d} ==\n", sum2);
     return sum1 == 6'519'155'389'266 && sum2 == 6'547'228'115'826;
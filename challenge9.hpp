@@ -1,9 +1,29 @@
 #ifndef CHALLENGE9_HPP
 #define CHALLENGE9_HPP
 
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
 bool challenge9(const std::vector<std::string_view>& input);
 
+namespace day9 {
+using FileBlock               = std::int16_t;
+
+constexpr FileBlock FreeBlock = -1;
+
+std::vector<FileBlock> parse(std::string_view input) noexcept;
+std::int64_t           moveFileBlocksAndBuildCheckSum(const std::vector<FileBlock>& fileBlocks);
+std::int64_t           moveFilesAndBuildCheckSum(std::vector<FileBlock>& fileBlocks);
+
+//Moves single blocks on the disk map itself, with one index from the front and one from the back. Every run of blocks
+//of one file adds an arithmetic series to the checksum, there is no block array and the ids are 64 bit.
+std::int64_t compactBlocks(std::string_view diskMap);
+
+//Moves whole files on the disk map itself, as spans of files and gaps. The starts of the gaps are kept in one min heap
+//per gap size, so the leftmost fitting gap is the smallest top of the heaps for the file size and above, and the rest
+//of a gap goes back into the heap for its new size. The checksum of a file is computed in one step.
+std::int64_t compactFiles(std::string_view diskMap);
+} //namespace day9
+
 #endif //CHALLENGE9_HPP
@@ -0,0 +1,572 @@
+#include "challenge1.hpp"
+#include "challenge10.hpp"
+#include "challenge11.hpp"
+#include "challenge17.hpp"
+#include "challenge2.hpp"
+#include "challenge3.hpp"
+#include "challenge4.hpp"
+#include "challenge5.hpp"
+#include "challenge6.hpp"
+#include "challenge7.hpp"
+#include "challenge8.hpp"
+#include "challenge9.hpp"
+#include "gridsearch.hpp"
+#include "helper.hpp"
+#include "inputgenerators.hpp"
+#include "print.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+namespace {
+//The result of the reference and of the optimized kernel.
+using Results = std::pair<std::int64_t, std::int64_t>;
+
+//Compares a reference kernel with its optimized counterpart on small random inputs.
+struct Check {
+    std::string_view Name;
+    GeneratedInput (*Generate)(std::uint64_t seed);
+    Results (*Run)(const std::vector<std::string_view>& input);
+};
+
+Results runSortAndSumOfDistances(const std::vector<std::string_view>& input) {
+    std::vector<std::int64_t> left(input.size());
+    std::vector<std::int64_t> right(input.size());
+    for ( auto&& [l, r, line] : std::views::zip(left, right, input) ) {
+        day1::parseLine(line, l, r);
+    } //for ( auto&& [l, r, line] : std::views::zip(left, right, input) )
+
+    auto referenceLeft  = left;
+    auto referenceRight = right;
+    std::ranges::sort(referenceLeft);
+    std::ranges::sort(referenceRight);
+    const auto reference = std::ranges::fold_left(
+        std::views::zip(referenceLeft, referenceRight) |
+            std::views::transform([](auto pair) noexcept { return std::abs(std::get<0>(pair) - std::get<1>(pair)); }),
+        std::int64_t{0}, std::plus<>{});
+
+    day1::radixSort(left);
+    day1::radixSort(right);
+    //Also compare the order itself, not only the sum.
+    if ( left != referenceLeft || right != referenceRight ) {
+        return {reference, -1};
+    } //if ( left != referenceLeft || right != referenceRight )
+    return {reference, day1::sumOfDistances(left, right)};
+}
+
+Results runSimilarity(const std::vector<std::string_view>& input) {
+    std::vector<std::int64_t> left(input.size());
+    std::vector<std::int64_t> right(input.size());
+    day1::LocationLists       lists;
+    for ( auto&& [l, r, line] : std::views::zip(left, right, input) ) {
+        day1::parseLine(line, l, r);
+        lists.add(l, r);
+    } //for ( auto&& [l, r, line] : std::views::zip(left, right, input) )
+
+    const auto optimized = day1::similarityByCounting(left, right);
+    std::ranges::sort(left);
+    std::ranges::sort(right);
+    const auto reference = day1::similarityBySorting(left, right);
+
+    //The incremental lists have to agree on both parts.
+    if ( lists.similarity() != optimized || lists.distanceSum() != day1::sumOfDistances(left, right) ) {
+        return {reference, -1};
+    } //if ( lists.similarity() != optimized || lists.distanceSum() != day1::sumOfDistances(left, right) )
+    return {reference, optimized};
+}
+
+Results runReportChecker(const std::vector<std::string_view>& input) {
+    //Small inputs, so both counts fit into one number.
+    static constexpr std::int64_t DampenedFactor = 1'000'000;
+
+    Results ret{};
+    for ( auto line : input ) {
+        const auto differences = day2::toDifferences(line);
+        if ( day2::isSafe(differences) ) {
+            ++ret.first;
+        } //if ( day2::isSafe(differences) )
+        else if ( day2::isDampenedSafe(differences) ) {
+            ret.first += DampenedFactor;
+        } //else if ( day2::isDampenedSafe(differences) )
+
+        const auto report = day2::checkReport(line);
+        if ( report.isSafe() ) {
+            ++ret.second;
+        } //if ( report.isSafe() )
+        else if ( report.isDampenedSafe() ) {
+            ret.second += DampenedFactor;
+        } //else if ( report.isDampenedSafe() )
+    } //for ( auto line : input )
+    return ret;
+}
+
+Results runReportBatch(const std::vector<std::string_view>& input) {
+    static constexpr std::int64_t DampenedFactor = 1'000'000;
+
+    Results           ret{};
+    day2::ReportBatch batch;
+    for ( auto line : input ) {
+        const auto report  = day2::checkReport(line);
+        ret.first         += (report.isSafe() ? 1 : 0) + (report.isDampenedSafe() ? DampenedFactor : 0);
+
+        if ( !batch.add(line) ) {
+            ret.second += (report.isSafe() ? 1 : 0) + (report.isDampenedSafe() ? DampenedFactor : 0);
+        } //if ( !batch.add(line) )
+    } //for ( auto line : input )
+    ret.second += batch.countSafe() + batch.countSafeWithDampener() * DampenedFactor;
+    return ret;
+}
+
+template<bool OnlyEnabled>
+Results runScanMemory(const std::vector<std::string_view>& input) {
+    Results         ret{};
+    bool            enabled = true;
+    day3::ScanState state;
+    for ( auto line : input ) {
+        ret.first += OnlyEnabled ? day3::findMulWithEnabled(line, enabled) : day3::findMul(line);
+        day3::scanMemory(line, state);
+    } //for ( auto line : input )
+    ret.second = OnlyEnabled ? state.EnabledSum : state.Sum;
+    return ret;
+}
+
+Results runScanMemoryParallel(const std::vector<std::string_view>& input) {
+    Results ret{};
+    bool    enabled = true;
+    for ( auto line : input ) {
+        ret.first += day3::findMulWithEnabled(line, enabled);
+    } //for ( auto line : input )
+
+    //Every chunking has to agree, including chunks smaller than a match.
+    for ( auto numberOfChunks : {2zu, 3zu, 7zu, 64zu} ) {
+        day3::ScanState state;
+        for ( auto line : input ) {
+            day3::scanMemoryParallel(line, state, numberOfChunks);
+        } //for ( auto line : input )
+
+        if ( state.EnabledSum != ret.first ) {
+            ret.second = state.EnabledSum;
+            return ret;
+        } //if ( state.EnabledSum != ret.first )
+    } //for ( auto numberOfChunks : {2zu, 3zu, 7zu, 64zu} )
+    ret.second = ret.first;
+    return ret;
+}
+
+template<bool CrossMas>
+Results runLetterBoards(const std::vector<std::string_view>& input) {
+    const day4::LetterBoards boards{input};
+    if constexpr ( CrossMas ) {
+        return {day4::countCrossMas(input), boards.countCrossMas()};
+    } //if constexpr ( CrossMas )
+    else {
+        return {day4::countXmas<false>(input), boards.countXmas()};
+    } //else -> if constexpr ( CrossMas )
+}
+
+template<bool CrossMas>
+Results runGridSearch(const std::vector<std::string_view>& input) {
+    if constexpr ( CrossMas ) {
+        Stencil      stencil{{"M.S", ".A.", "M.S"}};
+        std::int64_t count = 0;
+        for ( int rotation = 0; rotation < 4; ++rotation, stencil = stencil.rotated() ) {
+            count += countStencil(input, stencil);
+        } //for ( int rotation = 0; rotation < 4; ++rotation, stencil = stencil.rotated() )
+        return {day4::countCrossMas(input), count};
+    } //if constexpr ( CrossMas )
+    else {
+        static constexpr std::array words{"XMAS"sv};
+        return {day4::countXmas<false>(input), GridSearch{words}.count(input).front()};
+    } //else -> if constexpr ( CrossMas )
+}
+
+template<bool Repair>
+Results runPrecedenceMatrix(const std::vector<std::string_view>& input) {
+    auto    data = day5::parse(input);
+    Results ret{};
+    for ( auto& update : data.Updates ) {
+        if constexpr ( Repair ) {
+            auto reference = update;
+            if ( !day5::isCorrectlyOrdered(data, reference) ) {
+                ret.first += day5::midPoint(day5::bringToCorrectOrder(data, reference));
+            } //if ( !day5::isCorrectlyOrdered(data, reference) )
+            if ( !data.Precedences.isCorrectlyOrdered(update) ) {
+                ret.second += data.Precedences.correctedMiddle(update);
+            } //if ( !data.Precedences.isCorrectlyOrdered(update) )
+        } //if constexpr ( Repair )
+        else {
+            ret.first  += day5::isCorrectlyOrdered(data, update) ? day5::midPoint(update) : 0;
+            ret.second += data.Precedences.isCorrectlyOrdered(update) ? day5::midPoint(update) : 0;
+        } //else -> if constexpr ( Repair )
+    } //for ( auto& update : data.Updates )
+    return ret;
+}
+
+//Every update is given twice, the second time the order comes from the cache.
+template<bool Repair>
+Results runOrderingEngine(const std::vector<std::string_view>& input) {
+    const auto           data = day5::parse(input);
+    day5::OrderingEngine engine{data.Precedences};
+    Results              ret{};
+    for ( int pass = 0; pass < 2; ++pass ) {
+        for ( auto update : data.Updates ) {
+            const auto ordered = engine.isCorrectlyOrdered(update);
+            if constexpr ( Repair ) {
+                if ( !day5::isCorrectlyOrdered(data, update) ) {
+                    ret.first += day5::midPoint(day5::bringToCorrectOrder(data, update));
+                } //if ( !day5::isCorrectlyOrdered(data, update) )
+                ret.second += ordered ? 0 : day5::midPoint(engine.correctOrder(update));
+            } //if constexpr ( Repair )
+            else {
+                ret.first  += day5::isCorrectlyOrdered(data, update) ? day5::midPoint(update) : 0;
+                ret.second += ordered ? day5::midPoint(update) : 0;
+            } //else -> if constexpr ( Repair )
+        } //for ( auto update : data.Updates )
+    } //for ( int pass = 0; pass < 2; ++pass )
+    return ret;
+}
+
+template<bool Obstacles>
+Results runPatrolMap(const std::vector<std::string_view>& input) {
+    const day6::PatrolMap map{input};
+    //The reference would never finish.
+    throwIfInvalid(map.guardLeaves());
+    const auto start = day6::findStart(input);
+    if constexpr ( Obstacles ) {
+        return {day6::findObstaclesForLoop(input, start), map.countLoopObstacles()};
+    } //if constexpr ( Obstacles )
+    else {
+        return {static_cast<std::int64_t>(day6::moveFromMap(input, start)), map.countVisited()};
+    } //else -> if constexpr ( Obstacles )
+}
+
+template<bool WithConcatenation>
+Results runIsEquationValid(const std::vector<std::string_view>& input) {
+    const auto equations = day7::parse(input);
+    Results    ret{};
+    for ( const auto& equation : equations ) {
+        ret.first  += day7::isEquationValidGeneric<WithConcatenation>(equation) ? equation.Result : 0;
+        ret.second += day7::isEquationValid<WithConcatenation>(equation) ? equation.Result : 0;
+    } //for ( const auto& equation : equations )
+    return ret;
+}
+
+template<bool Resonant>
+Results runAntennaMap(const std::vector<std::string_view>& input) {
+    const day8::AntennaMap map{input};
+    const auto             antennas = day8::findAntennas(input);
+    if constexpr ( Resonant ) {
+        return {static_cast<std::int64_t>(day8::countResonantAntinodes(antennas)), map.countResonantAntinodes()};
+    } //if constexpr ( Resonant )
+    else {
+        return {static_cast<std::int64_t>(day8::countAntinodes(antennas)), map.countAntinodes()};
+    } //else -> if constexpr ( Resonant )
+}
+
+template<bool Ratings>
+Results runTrailMap(const std::vector<std::string_view>& input) {
+    const auto sums = day10::TrailMap{input}.sum();
+    if constexpr ( Ratings ) {
+        return {day10::sumRatings(input), sums.Ratings};
+    } //if constexpr ( Ratings )
+    else {
+        return {day10::sumScores(input), sums.Scores};
+    } //else -> if constexpr ( Ratings )
+}
+
+template<bool WithConcatenation>
+Results runSumValidParallel(const std::vector<std::string_view>& input) {
+    const auto equations = day7::parse(input);
+    const auto batch     = day7::parseBatch(input);
+    Results    ret{};
+    for ( const auto& equation : equations ) {
+        ret.first += day7::isEquationValidGeneric<WithConcatenation>(equation) ? equation.Result : 0;
+    } //for ( const auto& equation : equations )
+
+    //Every thread count has to give the same result, report the first one which does not.
+    for ( auto numberOfThreads : {1zu, 2zu, 3zu, 8zu} ) {
+        const auto sums = day7::sumValidParallel(batch, numberOfThreads);
+        ret.second      = WithConcatenation ? sums.TotalWithConcatenation : sums.Total;
+        if ( ret.second != ret.first ) {
+            break;
+        } //if ( ret.second != ret.first )
+    } //for ( auto numberOfThreads : {1zu, 2zu, 3zu, 8zu} )
+    return ret;
+}
+
+template<bool WithConcatenation>
+Results runIsEquationValidReverse(const std::vector<std::string_view>& input) {
+    const auto equations = day7::parse(input);
+    Results    ret{};
+    for ( const auto& equation : equations ) {
+        ret.first  += day7::isEquationValidGeneric<WithConcatenation>(equation) ? equation.Result : 0;
+        ret.second += day7::isEquationValidReverse<WithConcatenation>(equation.Result, equation.Operands)
+                          ? equation.Result
+                          : 0;
+    } //for ( const auto& equation : equations )
+    return ret;
+}
+
+struct KnownEquation {
+    std::string_view Line;
+    bool             Valid;
+    bool             ValidWithConcatenation;
+};
+
+//Equations with 0 operands, which the random ones rarely hit in the interesting way.
+constexpr std::array knownEquations{
+    KnownEquation{"120: 12 0"sv, false, true},    KnownEquation{"4: 5 3 0 4"sv, true, true},
+    KnownEquation{"12: 12 0"sv, true, true},      KnownEquation{"35: 5 0 7"sv, true, true},
+    KnownEquation{"1200: 12 0 0"sv, false, true}, KnownEquation{"7: 12 0"sv, false, false},
+    KnownEquation{"50: 5 0"sv, false, true}};
+
+GeneratedInput generateKnownEquations(std::uint64_t) {
+    std::string content;
+    for ( const auto& known : knownEquations ) {
+        content.append(known.Line).push_back('\n');
+    } //for ( const auto& known : knownEquations )
+    return GeneratedInput{std::move(content)};
+}
+
+//Compares the forward and the backward search against the known validity, not only against each other.
+template<bool WithConcatenation>
+Results runKnownEquations(const std::vector<std::string_view>& input) {
+    const auto equations = day7::parse(input);
+    Results    ret{};
+    for ( auto&& [line, equation] : std::views::zip(input, equations) ) {
+        const auto known    = std::ranges::find(knownEquations, line, &KnownEquation::Line);
+        const auto valid    = WithConcatenation ? known->ValidWithConcatenation : known->Valid;
+        const auto forward  = day7::isEquationValidGeneric<WithConcatenation>(equation);
+        const auto backward = day7::isEquationValidReverse<WithConcatenation>(equation.Result, equation.Operands);
+        //A wrong search always adds more than expected, so two errors can not cancel out.
+        ret.first  += valid ? equation.Result : 0;
+        ret.second += forward == valid && backward == valid ? (valid ? equation.Result : 0) : equation.Result + 1;
+    } //for ( auto&& [line, equation] : std::views::zip(input, equations) )
+    return ret;
+}
+
+const std::array checks{
+    Check{"day1/radixSort and sumOfDistances",
+          [](std::uint64_t seed) { return generateLocationLists(seed % 200 + 1, seed); }, runSortAndSumOfDistances},
+    Check{"day1/similarity", [](std::uint64_t seed) { return generateLocationLists(seed % 200 + 1, seed); },
+          runSimilarity},
+    Check{"day2/ReportChecker", [](std::uint64_t seed) { return generateReports(seed % 50 + 1, seed); },
+          runReportChecker},
+    //At most one batch, the reports which do not fit are checked by the reference.
+    Check{"day2/ReportBatch",
+          [](std::uint64_t seed) { return generateReports(seed % day2::ReportBatch::Width + 1, seed); },
+          runReportBatch},
+    Check{"day3/scanMemory", [](std::uint64_t seed) { return generateCorruptedMemory(seed % 2'000 + 1, seed); },
+          runScanMemory<false>},
+    Check{"day3/scanMemory enabled",
+          [](std::uint64_t seed) { return generateCorruptedMemory(seed % 2'000 + 1, seed); }, runScanMemory<true>},
+    Check{"day3/scanMemoryParallel",
+          [](std::uint64_t seed) { return generateCorruptedMemory(seed % 2'000 + 1, seed); }, runScanMemoryParallel},
+    Check{"day4/countXmas",
+          [](std::uint64_t seed) {
+              return generateWordSearch(seed % 12 + 1, seed / 12 % 12 + 1, seed);
+          },
+          [](const std::vector<std::string_view>& input) {
+              return Results{day4::countXmas<false>(input), day4::countXmas<true>(input)};
+          }},
+    //The reference for the X-MAS needs at least 3 rows and columns.
+    Check{"day4/LetterBoards countXmas",
+          [](std::uint64_t seed) { return generateWordSearch(seed % 12 + 3, seed / 12 % 140 + 3, seed); },
+          runLetterBoards<false>},
+    Check{"day4/LetterBoards countCrossMas",
+          [](std::uint64_t seed) { return generateWordSearch(seed % 12 + 3, seed / 12 % 140 + 3, seed); },
+          runLetterBoards<true>},
+    Check{"day4/GridSearch",
+          [](std::uint64_t seed) { return generateWordSearch(seed % 12 + 3, seed / 12 % 140 + 3, seed); },
+          runGridSearch<false>},
+    Check{"day4/countStencil",
+          [](std::uint64_t seed) { return generateWordSearch(seed % 12 + 3, seed / 12 % 140 + 3, seed); },
+          runGridSearch<true>},
+    Check{"day5/PrecedenceMatrix", [](std::uint64_t seed) { return generatePrintQueue(seed % 20 + 1, seed); },
+          runPrecedenceMatrix<false>},
+    Check{"day5/PrecedenceMatrix repair", [](std::uint64_t seed) { return generatePrintQueue(seed % 20 + 1, seed); },
+          runPrecedenceMatrix<true>},
+    Check{"day5/OrderingEngine", [](std::uint64_t seed) { return generatePrintQueue(seed % 20 + 1, seed); },
+          runOrderingEngine<false>},
+    Check{"day5/OrderingEngine repair", [](std::uint64_t seed) { return generatePrintQueue(seed % 20 + 1, seed); },
+          runOrderingEngine<true>},
+    Check{"day6/PatrolMap countVisited",
+          [](std::uint64_t seed) { return generatePatrolMap(seed % 20 + 1, seed / 20 % 20 + 1, seed); },
+          runPatrolMap<false>},
+    Check{"day6/PatrolMap countLoopObstacles",
+          [](std::uint64_t seed) { return generatePatrolMap(seed % 20 + 1, seed / 20 % 20 + 1, seed); },
+          runPatrolMap<true>},
+    Check{"day7/isEquationValid",
+          [](std::uint64_t seed) { return generateEquations(8, seed % 12 + 1, seed); }, runIsEquationValid<false>},
+    Check{"day7/isEquationValid concatenation",
+          [](std::uint64_t seed) { return generateEquations(8, seed % 12 + 1, seed); }, runIsEquationValid<true>},
+    Check{"day7/isEquationValidReverse",
+          [](std::uint64_t seed) { return generateEquations(8, seed % 12 + 1, seed); },
+          runIsEquationValidReverse<false>},
+    Check{"day7/isEquationValidReverse concatenation",
+          [](std::uint64_t seed) { return generateEquations(8, seed % 12 + 1, seed); },
+          runIsEquationValidReverse<true>},
+    Check{"day7/known equations", generateKnownEquations, runKnownEquations<false>},
+    Check{"day7/known equations concatenation", generateKnownEquations, runKnownEquations<true>},
+    Check{"day7/sumValidParallel",
+          [](std::uint64_t seed) { return generateEquations(seed % 20 + 1, seed % 12 + 1, seed); },
+          runSumValidParallel<false>},
+    Check{"day7/sumValidParallel concatenation",
+          [](std::uint64_t seed) { return generateEquations(seed % 20 + 1, seed % 12 + 1, seed); },
+          runSumValidParallel<true>},
+    Check{"day8/AntennaMap countAntinodes",
+          [](std::uint64_t seed) { return generateAntennaMap(seed % 30 + 1, seed / 30 % 30 + 1, seed % 40, 3, seed); },
+          runAntennaMap<false>},
+    Check{"day8/AntennaMap countResonantAntinodes",
+          [](std::uint64_t seed) { return generateAntennaMap(seed % 30 + 1, seed / 30 % 30 + 1, seed % 40, 3, seed); },
+          runAntennaMap<true>},
+    Check{"day9/compactBlocks", [](std::uint64_t seed) { return generateDiskMap(seed % 200 + 1, seed); },
+          [](const std::vector<std::string_view>& input) {
+              return Results{day9::moveFileBlocksAndBuildCheckSum(day9::parse(input.front())),
+                             day9::compactBlocks(input.front())};
+          }},
+    Check{"day9/compactFiles", [](std::uint64_t seed) { return generateDiskMap(seed % 200 + 1, seed); },
+          [](const std::vector<std::string_view>& input) {
+              auto fileBlocks = day9::parse(input.front());
+              return Results{day9::moveFilesAndBuildCheckSum(fileBlocks), day9::compactFiles(input.front())};
+          }},
+    Check{"day10/TrailMap scores",
+          [](std::uint64_t seed) { return generateTopographicMap(seed % 30 + 1, seed / 30 % 30 + 1, seed % 20, seed); },
+          runTrailMap<false>},
+    Check{"day10/TrailMap ratings",
+          [](std::uint64_t seed) { return generateTopographicMap(seed % 30 + 1, seed / 30 % 30 + 1, seed % 20, seed); },
+          runTrailMap<true>},
+    Check{"day11/StoneHistogram", [](std::uint64_t seed) { return generateStones(seed % 10 + 1, seed); },
+          [](const std::vector<std::string_view>& input) {
+              //Up to 50 blinks, so the reference does not overflow.
+              const auto            values = day11::parse(input.front());
+              const auto            blinks = values.front() % 51;
+              day11::StoneHistogram histogram{values};
+              histogram.blinkUntil(blinks);
+              return Results{day11::countStones(values, blinks), static_cast<std::int64_t>(histogram.count())};
+          }},
+    Check{"day17/runForRegisterValues", [](std::uint64_t seed) { return generateProgram(seed); },
+          [](const std::vector<std::string_view>& input) {
+              const auto a = convert(input.front().substr("Register A: "sv.size()));
+              return Results{day17::runForRegisterValues<false>(input, a, 64),
+                             day17::runForRegisterValues<true>(input, a, 64)};
+          }},
+};
+
+bool mismatches(const Check& check, const std::vector<std::string_view>& input) noexcept {
+    try {
+        const auto [reference, optimized] = check.Run(input);
+        return reference != optimized;
+    } //try
+    catch ( const std::exception& ) {
+        //A reduced input which is not valid anymore does not reproduce anything.
+        return false;
+    } //catch ( const std::exception& )
+}
+
+//Drops lines as long as the mismatch persists.
+std::vector<std::string_view> minimize(const Check& check, std::vector<std::string_view> input) {
+    for ( std::size_t index = 0; index < input.size() && input.size() > 1; ) {
+        auto candidate = input;
+        candidate.erase(std::next(candidate.begin(), static_cast<std::ptrdiff_t>(index)));
+        if ( mismatches(check, candidate) ) {
+            input = std::move(candidate);
+        } //if ( mismatches(check, candidate) )
+        else {
+            ++index;
+        } //else -> if ( mismatches(check, candidate) )
+    } //for ( std::size_t index = 0; index < input.size() && input.size() > 1; )
+    return input;
+}
+
+//Returns whether all runs agreed, prints the first mismatch otherwise.
+bool runCheck(const Check& check, std::uint64_t firstSeed, std::uint64_t runs) {
+    for ( auto seed = firstSeed; seed < firstSeed + runs; ++seed ) {
+        const auto input                  = check.Generate(seed);
+        const auto [reference, optimized] = check.Run(input.lines());
+
+        if ( reference == optimized ) {
+            continue;
+        } //if ( reference == optimized )
+
+        const auto reduced                          = minimize(check, input.lines());
+        const auto [reducedReference, reducedFound] = check.Run(reduced);
+        myPrint("{:s}: mismatch for seed {:d}, reference {:d}, optimized {:d}. Minimized input (reference {:d}, "
+                "optimized {:d}):\n",
+                check.Name, seed, reference, optimized, reducedReference, reducedFound);
+        for ( auto line : reduced ) {
+            myPrint("{:s}\n", line);
+        } //for ( auto line : reduced )
+        return false;
+    } //for ( auto seed = firstSeed; seed < firstSeed + runs; ++seed )
+
+    myPrint("{:s}: {:d} runs passed\n", check.Name, runs);
+    return true;
+}
+} //namespace
+
+/**
+ * @brief Compares the optimized kernels with their reference implementations.
+ * @param[in] argc Die Anzahl der Arguments.
+ * @param[in] argv Die Werte der Argumente: [filter] [--runs N] [--seed S], only checks containing filter are run, each
+ *                 on N inputs generated from the seeds S, S + 1, ...
+ * @result 0 bei Erfolg.
+ */
+int main(int argc, const char* argv[]) {
+    std::string_view filter;
+    std::uint64_t    runs      = 1'000;
+    std::uint64_t    firstSeed = 1;
+
+    const std::span arguments{argv + 1, argv + argc};
+    for ( auto iter = arguments.begin(); iter != arguments.end(); ++iter ) {
+        if ( *iter == "--runs"sv || *iter == "--seed"sv ) {
+            const auto option = std::string_view{*iter};
+            if ( ++iter == arguments.end() ) {
+                myErr("{:s} needs a value!\n", option);
+                return -1;
+            } //if ( ++iter == arguments.end() )
+
+            const auto value = convertOptionally(*iter);
+            if ( !value || *value < 0 ) {
+                myErr("Invalid value {:s} for {:s}!\n", *iter, option);
+                return -1;
+            } //if ( !value || *value < 0 )
+            (option == "--runs"sv ? runs : firstSeed) = static_cast<std::uint64_t>(*value);
+        } //if ( *iter == "--runs"sv || *iter == "--seed"sv )
+        else {
+            filter = *iter;
+        } //else -> if ( *iter == "--runs"sv || *iter == "--seed"sv )
+    } //for ( auto iter = arguments.begin(); iter != arguments.end(); ++iter )
+
+    int failed = 0;
+    for ( const auto& check : checks ) {
+        if ( !check.Name.contains(filter) ) {
+            continue;
+        } //if ( !check.Name.contains(filter) )
+
+        try {
+            if ( !runCheck(check, firstSeed, runs) ) {
+                ++failed;
+            } //if ( !runCheck(check, firstSeed, runs) )
+        } //try
+        catch ( const std::exception& e ) {
+            myPrint("{:s}: {:s}\n", check.Name, e.what());
+            ++failed;
+        } //catch ( const std::exception& e )
+    } //for ( const auto& check : checks )
+    myFlush();
+    return failed == 0 ? 0 : -2;
+}
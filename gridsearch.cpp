@@ -0,0 +1,251 @@
+#include "gridsearch.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <utility>
+
+namespace {
+std::vector<std::string> withReversed(std::span<const std::string_view> words) {
+    std::vector<std::string> ret;
+    ret.reserve(words.size() * 2);
+    std::ranges::transform(words, std::back_inserter(ret), [](std::string_view word) { return std::string{word}; });
+    std::ranges::transform(words, std::back_inserter(ret),
+                           [](std::string_view word) { return std::string{word.rbegin(), word.rend()}; });
+    return ret;
+}
+} //namespace
+
+AhoCorasick::AhoCorasick(std::span<const std::string> patterns) {
+    for ( const auto& pattern : patterns ) {
+        throwIfInvalid(!pattern.empty(), "Empty pattern");
+        for ( auto c : pattern ) {
+            auto& mapped = Alphabet[static_cast<unsigned char>(c)];
+            if ( mapped == 0 ) {
+                throwIfInvalid(AlphabetSize < Alphabet.size(), "Too many different characters");
+                mapped = static_cast<std::uint8_t>(AlphabetSize++);
+            } //if ( mapped == 0 )
+        } //for ( auto c : pattern )
+    } //for ( const auto& pattern : patterns )
+
+    //Build the trie, 0 is the root and marks missing children, since the root is nobody's child.
+    std::vector<std::vector<std::uint32_t>> outputs(1);
+    Transitions.resize(AlphabetSize);
+    for ( std::uint32_t index = 0; const auto& pattern : patterns ) {
+        auto state = start();
+        for ( auto c : pattern ) {
+            const auto transition = state * AlphabetSize + Alphabet[static_cast<unsigned char>(c)];
+            if ( Transitions[transition] == 0 ) {
+                Transitions[transition] = static_cast<State>(outputs.size());
+                outputs.emplace_back();
+                Transitions.resize(Transitions.size() + AlphabetSize);
+            } //if ( Transitions[transition] == 0 )
+            state = Transitions[transition];
+        } //for ( auto c : pattern )
+        outputs[state].push_back(index++);
+    } //for ( std::uint32_t index = 0; const auto& pattern : patterns )
+
+    //Breadth first, so the failure target of a state is complete, before the state is handled. Missing transitions are
+    //replaced by the one of the failure target, and the outputs of the failure target are inherited.
+    std::vector<State> failure(outputs.size(), start());
+    std::vector<State> queue;
+    for ( std::size_t c = 0; c < AlphabetSize; ++c ) {
+        if ( const auto child = Transitions[c]; child != 0 ) {
+            queue.push_back(child);
+        } //if ( const auto child = Transitions[c]; child != 0 )
+    } //for ( std::size_t c = 0; c < AlphabetSize; ++c )
+
+    for ( std::size_t index = 0; index < queue.size(); ++index ) {
+        const auto state = queue[index];
+        for ( std::size_t c = 0; c < AlphabetSize; ++c ) {
+            auto&      child    = Transitions[state * AlphabetSize + c];
+            const auto fallback = Transitions[failure[state] * AlphabetSize + c];
+            if ( child == 0 ) {
+                child = fallback;
+                continue;
+            } //if ( child == 0 )
+
+            failure[child] = fallback;
+            std::ranges::copy(outputs[fallback], std::back_inserter(outputs[child]));
+            queue.push_back(child);
+        } //for ( std::size_t c = 0; c < AlphabetSize; ++c )
+    } //for ( std::size_t index = 0; index < queue.size(); ++index )
+
+    OutputBegin.reserve(outputs.size() + 1);
+    for ( const auto& output : outputs ) {
+        OutputBegin.push_back(static_cast<std::uint32_t>(Outputs.size()));
+        std::ranges::copy(output, std::back_inserter(Outputs));
+    } //for ( const auto& output : outputs )
+    OutputBegin.push_back(static_cast<std::uint32_t>(Outputs.size()));
+    return;
+}
+
+GridSearch::GridSearch(std::span<const std::string_view> words) :
+        NumberOfWords{words.size()},
+        Lengths{words | std::views::transform(&std::string_view::size) | std::ranges::to<std::vector>()},
+        Patterns{withReversed(words)}, Automaton{Patterns} {
+    return;
+}
+
+std::vector<std::int64_t> GridSearch::count(const std::vector<std::string_view>& grid) const {
+    std::vector<std::int64_t> ret(NumberOfWords);
+    scan(grid, [&ret](std::size_t word, Coordinate<std::int64_t>, CoordinateOffset<std::int64_t>) noexcept {
+        ++ret[word];
+        return;
+    });
+    return ret;
+}
+
+std::vector<GridSearch::Match> GridSearch::find(const std::vector<std::string_view>& grid) const {
+    std::vector<Match> ret;
+    scan(grid, [&ret](std::size_t word, Coordinate<std::int64_t> start, CoordinateOffset<std::int64_t> step) {
+        ret.push_back({word, start, step});
+        return;
+    });
+    return ret;
+}
+
+template<typename Callback>
+void GridSearch::scan(const std::vector<std::string_view>& grid, Callback&& onMatch) const {
+    const auto rows    = std::ssize(grid);
+    const auto columns = grid.empty() ? 0 : std::ssize(grid.front());
+    throwIfInvalid(std::ranges::all_of(grid, [columns](std::string_view row) noexcept {
+        return std::ssize(row) == columns;
+    }));
+
+    auto isInside = [rows, columns](Coordinate<std::int64_t> position) noexcept {
+        return position.Row >= 0 && position.Row < rows && position.Column >= 0 && position.Column < columns;
+    };
+
+    //A match of a reversed word is the word itself, read in the opposite direction from where the match ends.
+    auto scanLine = [this, &grid, &onMatch, &isInside](Coordinate<std::int64_t>       position,
+                                                       CoordinateOffset<std::int64_t> step) {
+        auto state = AhoCorasick::start();
+        for ( ; isInside(position); position += step ) {
+            state = Automaton.next(state, MapView{grid}[position]);
+            for ( std::size_t pattern : Automaton.matches(state) ) {
+                if ( pattern < NumberOfWords ) {
+                    const auto length = static_cast<std::int64_t>(Lengths[pattern]);
+                    onMatch(pattern, position + step * (1 - length), step);
+                } //if ( pattern < NumberOfWords )
+                else {
+                    onMatch(pattern - NumberOfWords, position, step * -1);
+                } //else -> if ( pattern < NumberOfWords )
+            } //for ( std::size_t pattern : Automaton.matches(state) )
+        } //for ( ; isInside(position); position += step )
+        return;
+    };
+
+    for ( std::int64_t row = 0; row < rows; ++row ) {
+        scanLine({row, 0}, {0, 1});
+        scanLine({row, 0}, {1, 1});
+    } //for ( std::int64_t row = 0; row < rows; ++row )
+
+    for ( std::int64_t column = 0; column < columns; ++column ) {
+        scanLine({0, column}, {1, 0});
+        scanLine({0, column}, {1, -1});
+        //The diagonals starting in the first column, respectively the last one, are already handled above and below.
+        if ( column > 0 ) {
+            scanLine({0, column}, {1, 1});
+        } //if ( column > 0 )
+    } //for ( std::int64_t column = 0; column < columns; ++column )
+
+    for ( std::int64_t row = 1; row < rows; ++row ) {
+        scanLine({row, columns - 1}, {1, -1});
+    } //for ( std::int64_t row = 1; row < rows; ++row )
+    return;
+}
+
+Stencil Stencil::rotated(void) const {
+    Stencil ret;
+    if ( Rows.empty() ) {
+        return ret;
+    } //if ( Rows.empty() )
+
+    const auto rows    = Rows.size();
+    const auto columns = Rows.front().size();
+    ret.Rows.assign(columns, std::string(rows, '.'));
+    for ( std::size_t row = 0; row < rows; ++row ) {
+        for ( std::size_t column = 0; column < columns; ++column ) {
+            ret.Rows[column][rows - 1 - row] = Rows[row][column];
+        } //for ( std::size_t column = 0; column < columns; ++column )
+    } //for ( std::size_t row = 0; row < rows; ++row )
+    return ret;
+}
+
+std::vector<Coordinate<std::int64_t>> findStencil(const std::vector<std::string_view>& grid, const Stencil& stencil) {
+    const auto rows           = std::ssize(grid);
+    const auto columns        = grid.empty() ? 0 : std::ssize(grid.front());
+    const auto stencilRows    = std::ssize(stencil.Rows);
+    const auto stencilColumns = stencil.Rows.empty() ? 0 : std::ssize(stencil.Rows.front());
+    throwIfInvalid(std::ranges::all_of(grid, [columns](std::string_view row) noexcept {
+        return std::ssize(row) == columns;
+    }));
+    throwIfInvalid(std::ranges::all_of(stencil.Rows, [stencilColumns](const std::string& row) noexcept {
+        return std::ssize(row) == stencilColumns;
+    }));
+
+    std::vector<Coordinate<std::int64_t>> ret;
+    if ( stencilRows == 0 || stencilColumns == 0 || rows < stencilRows || columns < stencilColumns ) {
+        return ret;
+    } //if ( stencilRows == 0 || stencilColumns == 0 || rows < stencilRows || columns < stencilColumns )
+
+    //Only the fixed cells have to be compared, the longest run of them in one row is the anchor for the automaton.
+    std::vector<std::pair<CoordinateOffset<std::int64_t>, char>> fixed;
+    CoordinateOffset<std::int64_t>                               anchor{0, 0};
+    std::string_view                                             anchorRun;
+    for ( std::int64_t row = 0; row < stencilRows; ++row ) {
+        const std::string_view stencilRow = stencil.Rows[static_cast<std::size_t>(row)];
+        std::int64_t           runBegin   = 0;
+        for ( std::int64_t column = 0; column <= stencilColumns; ++column ) {
+            if ( column < stencilColumns && stencilRow[static_cast<std::size_t>(column)] != '.' ) {
+                fixed.emplace_back(CoordinateOffset{row, column}, stencilRow[static_cast<std::size_t>(column)]);
+                continue;
+            } //if ( column < stencilColumns && stencilRow[static_cast<std::size_t>(column)] != '.' )
+
+            if ( column - runBegin > std::ssize(anchorRun) ) {
+                anchor    = {row, runBegin};
+                anchorRun = stencilRow.substr(static_cast<std::size_t>(runBegin),
+                                              static_cast<std::size_t>(column - runBegin));
+            } //if ( column - runBegin > std::ssize(anchorRun) )
+            runBegin = column + 1;
+        } //for ( std::int64_t column = 0; column <= stencilColumns; ++column )
+    } //for ( std::int64_t row = 0; row < stencilRows; ++row )
+
+    auto matchesAt = [&grid, &fixed](Coordinate<std::int64_t> corner) noexcept {
+        return std::ranges::all_of(fixed, [&grid, corner](const auto& cell) noexcept {
+            return MapView{grid}[corner + cell.first] == cell.second;
+        });
+    };
+
+    if ( anchorRun.empty() ) {
+        //Only wildcards, every placement matches.
+        for ( std::int64_t row = 0; row + stencilRows <= rows; ++row ) {
+            for ( std::int64_t column = 0; column + stencilColumns <= columns; ++column ) {
+                ret.push_back({row, column});
+            } //for ( std::int64_t column = 0; column + stencilColumns <= columns; ++column )
+        } //for ( std::int64_t row = 0; row + stencilRows <= rows; ++row )
+        return ret;
+    } //if ( anchorRun.empty() )
+
+    const std::array  patterns{std::string{anchorRun}};
+    const AhoCorasick automaton{patterns};
+    for ( std::int64_t row = anchor.Row; row + stencilRows - anchor.Row <= rows; ++row ) {
+        auto state = AhoCorasick::start();
+        for ( std::int64_t column = 0; column < columns; ++column ) {
+            state = automaton.next(state, MapView{grid}[Coordinate{row, column}]);
+            if ( automaton.matches(state).empty() ) {
+                continue;
+            } //if ( automaton.matches(state).empty() )
+
+            const Coordinate corner{row - anchor.Row, column + 1 - std::ssize(anchorRun) - anchor.Column};
+            if ( corner.Column >= 0 && corner.Column + stencilColumns <= columns && matchesAt(corner) ) {
+                ret.push_back(corner);
+            } //if ( corner.Column >= 0 && corner.Column + stencilColumns <= columns && matchesAt(corner) )
+        } //for ( std::int64_t column = 0; column < columns; ++column )
+    } //for ( std::int64_t row = anchor.Row; row + stencilRows - anchor.Row <= rows; ++row )
+    return ret;
+}
+
+std::int64_t countStencil(const std::vector<std::string_view>& grid, const Stencil& stencil) {
+    return std::ssize(findStencil(grid, stencil));
+}
@@ -0,0 +1,84 @@
+#ifndef GRIDSEARCH_HPP
+#define GRIDSEARCH_HPP
+
+#include "helper.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//Finds all of a set of patterns in a text in one pass, independent of the number of patterns.
+class AhoCorasick {
+    public:
+    using State = std::uint32_t;
+
+    explicit AhoCorasick(std::span<const std::string> patterns);
+
+    static constexpr State start(void) noexcept {
+        return 0;
+    }
+
+    State next(State state, char c) const noexcept {
+        return Transitions[state * AlphabetSize + Alphabet[static_cast<unsigned char>(c)]];
+    }
+
+    //The indices of the patterns which end with the last character.
+    std::span<const std::uint32_t> matches(State state) const noexcept {
+        return std::span{Outputs}.subspan(OutputBegin[state], OutputBegin[state + 1] - OutputBegin[state]);
+    }
+
+    private:
+    //Characters which are in no pattern are mapped to 0.
+    std::array<std::uint8_t, 256> Alphabet{};
+    std::size_t                   AlphabetSize = 1;
+    //The complete automaton, the failure links are already resolved.
+    std::vector<State>            Transitions;
+    std::vector<std::uint32_t>    OutputBegin;
+    std::vector<std::uint32_t>    Outputs;
+};
+
+//Searches words in a grid in all 8 directions. The words and their reverses are put into one automaton, so every row,
+//column and diagonal is scanned only once.
+class GridSearch {
+    public:
+    struct Match {
+        std::size_t                    Word;
+        Coordinate<std::int64_t>       Start;
+        CoordinateOffset<std::int64_t> Step;
+    };
+
+    explicit GridSearch(std::span<const std::string_view> words);
+
+    //The number of occurrences for each word.
+    std::vector<std::int64_t> count(const std::vector<std::string_view>& grid) const;
+    std::vector<Match>        find(const std::vector<std::string_view>& grid) const;
+
+    private:
+    std::size_t              NumberOfWords;
+    std::vector<std::size_t> Lengths;
+    std::vector<std::string> Patterns;
+    AhoCorasick              Automaton;
+
+    template<typename Callback>
+    void scan(const std::vector<std::string_view>& grid, Callback&& onMatch) const;
+};
+
+//A two dimensional pattern, a '.' matches every character.
+struct Stencil {
+    std::vector<std::string> Rows;
+
+    //Rotated by 90° clockwise.
+    Stencil rotated(void) const;
+};
+
+//The top left corners of all placements of the stencil in the grid, in row major order. The longest run of fixed cells
+//in one row of the stencil is searched with an AhoCorasick automaton along the rows of the grid, only its matches are
+//compared completely.
+std::vector<Coordinate<std::int64_t>> findStencil(const std::vector<std::string_view>& grid, const Stencil& stencil);
+std::int64_t                          countStencil(const std::vector<std::string_view>& grid, const Stencil& stencil);
+
+#endif //GRIDSEARCH_HPP
@@ -0,0 +1,213 @@
+#include "inputarchive.hpp"
+
+#include "helper.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace std::string_view_literals;
+
+namespace {
+constexpr auto          Magic   = "AOC24PAK"sv;
+constexpr std::uint32_t Version = 1;
+
+static_assert(Magic.size() == sizeof(InputArchive::Header::Magic));
+
+constexpr std::uint64_t align(std::uint64_t offset) noexcept {
+    return (offset + InputArchive::Alignment - 1) / InputArchive::Alignment * InputArchive::Alignment;
+}
+
+std::string readFile(const std::filesystem::path& path) {
+    std::ifstream file{path, std::ios::binary};
+
+    if ( !file ) {
+        throw std::runtime_error{std::format("Could not open \"{:s}\"!", path.c_str())};
+    } //if ( !file )
+
+    return std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+void write(std::ofstream& file, const void* data, std::size_t size) {
+    file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    return;
+}
+
+void padTo(std::ofstream& file, std::uint64_t offset) {
+    static constexpr char zeros[InputArchive::Alignment]{};
+    write(file, zeros, offset - static_cast<std::uint64_t>(file.tellp()));
+    return;
+}
+} //namespace
+
+InputArchive::InputArchive(const std::filesystem::path& path) {
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if ( fd < 0 ) {
+        throw std::runtime_error{std::format("Could not open \"{:s}\"!", path.c_str())};
+    } //if ( fd < 0 )
+
+    struct stat status;
+    if ( ::fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(Header) ) {
+        ::close(fd);
+        throw std::runtime_error{std::format("\"{:s}\" is no input archive!", path.c_str())};
+    } //if ( ::fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(Header) )
+
+    Size          = static_cast<std::size_t>(status.st_size);
+    auto* mapping = ::mmap(nullptr, Size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    ::close(fd);
+
+    if ( mapping == MAP_FAILED ) {
+        throw std::runtime_error{std::format("Could not map \"{:s}\"!", path.c_str())};
+    } //if ( mapping == MAP_FAILED )
+
+    Mapping = static_cast<const std::byte*>(mapping);
+
+    Header header;
+    std::memcpy(&header, Mapping, sizeof(Header));
+    if ( std::string_view{header.Magic, sizeof(header.Magic)} != Magic || header.Version != Version ||
+         sizeof(Header) + header.NumberOfEntries * sizeof(Entry) > Size ) {
+        ::munmap(mapping, Size);
+        throw std::runtime_error{std::format("\"{:s}\" is no valid input archive!", path.c_str())};
+    } //if ( Magic or Version or Size do not match )
+
+    Entries = {reinterpret_cast<const Entry*>(Mapping + sizeof(Header)), header.NumberOfEntries};
+    return;
+}
+
+InputArchive::~InputArchive(void) {
+    ::munmap(const_cast<std::byte*>(Mapping), Size);
+    return;
+}
+
+bool InputArchive::isArchive(const std::filesystem::path& path) {
+    if ( !std::filesystem::is_regular_file(path) ) {
+        return false;
+    } //if ( !std::filesystem::is_regular_file(path) )
+
+    std::ifstream file{path, std::ios::binary};
+    char          magic[Magic.size()]{};
+    file.read(magic, sizeof(magic));
+    return file && std::string_view{magic, sizeof(magic)} == Magic;
+}
+
+void InputArchive::pack(const std::filesystem::path& dataDirectory, const std::filesystem::path& archivePath) {
+    std::vector<std::string> contents;
+    std::vector<Entry>       entries;
+
+    for ( std::uint32_t challenge = 1; challenge <= 25; ++challenge ) {
+        const auto inputFilePath = dataDirectory / std::format("{:d}.txt", challenge);
+
+        if ( !std::filesystem::is_regular_file(inputFilePath) ) {
+            continue;
+        } //if ( !std::filesystem::is_regular_file(inputFilePath) )
+
+        contents.push_back(readFile(inputFilePath));
+        entries.push_back({challenge, 0, 0, contents.back().size(), 0});
+    } //for ( std::uint32_t challenge = 1; challenge <= 25; ++challenge )
+
+    //Same line splitting as the directory mode in main, including the removal of trailing empty lines.
+    std::vector<std::vector<Line>> lineTables;
+    for ( auto&& [content, entry] : std::views::zip(contents, entries) ) {
+        auto& lines = lineTables.emplace_back();
+        for ( auto line : splitString<false>(content, '\n') ) {
+            lines.push_back({static_cast<std::uint64_t>(line.data() - content.data()), line.size()});
+        } //for ( auto line : splitString<false>(content, '\n') )
+
+        while ( !lines.empty() && lines.back().Length == 0 ) {
+            lines.pop_back();
+        } //while ( !lines.empty() && lines.back().Length == 0 )
+        entry.NumberOfLines = static_cast<std::uint32_t>(lines.size());
+    } //for ( auto&& [content, entry] : std::views::zip(contents, entries) )
+
+    auto offset = align(sizeof(Header) + entries.size() * sizeof(Entry));
+    for ( auto&& [entry, lines] : std::views::zip(entries, lineTables) ) {
+        entry.ContentOffset   = offset;
+        offset                = align(offset + entry.ContentSize);
+        entry.LineTableOffset = offset;
+        offset                = align(offset + lines.size() * sizeof(Line));
+
+        for ( auto& line : lines ) {
+            line.Offset += entry.ContentOffset;
+        } //for ( auto& line : lines )
+    } //for ( auto&& [entry, lines] : std::views::zip(entries, lineTables) )
+
+    std::ofstream file{archivePath, std::ios::binary | std::ios::trunc};
+    if ( !file ) {
+        throw std::runtime_error{std::format("Could not open \"{:s}\"!", archivePath.c_str())};
+    } //if ( !file )
+
+    Header header{{}, Version, static_cast<std::uint32_t>(entries.size())};
+    std::ranges::copy(Magic, header.Magic);
+    write(file, &header, sizeof(header));
+    write(file, entries.data(), entries.size() * sizeof(Entry));
+
+    for ( const auto& [entry, content, lines] : std::views::zip(entries, contents, lineTables) ) {
+        padTo(file, entry.ContentOffset);
+        write(file, content.data(), content.size());
+        padTo(file, entry.LineTableOffset);
+        write(file, lines.data(), lines.size() * sizeof(Line));
+    } //for ( const auto& [entry, content, lines] : std::views::zip(entries, contents, lineTables) )
+
+    if ( !file ) {
+        throw std::runtime_error{std::format("Could not write \"{:s}\"!", archivePath.c_str())};
+    } //if ( !file )
+    return;
+}
+
+const InputArchive::Entry* InputArchive::find(std::int64_t challenge) const noexcept {
+    auto iter = std::ranges::find_if(
+        Entries, [challenge](const Entry& entry) noexcept { return std::cmp_equal(entry.Challenge, challenge); });
+    return iter == Entries.end() ? nullptr : std::addressof(*iter);
+}
+
+bool InputArchive::contains(std::int64_t challenge) const noexcept {
+    return find(challenge) != nullptr;
+}
+
+std::string_view InputArchive::content(std::int64_t challenge) const {
+    const auto entry = find(challenge);
+    if ( !entry ) {
+        throw std::runtime_error{std::format("Challenge {:d} is not in the archive!", challenge)};
+    } //if ( !entry )
+    throwIfInvalid(entry->ContentOffset <= Size && entry->ContentSize <= Size - entry->ContentOffset,
+                   "Truncated input archive");
+    return {reinterpret_cast<const char*>(Mapping + entry->ContentOffset), entry->ContentSize};
+}
+
+void InputArchive::fillLines(std::int64_t challenge, std::vector<std::string_view>& lines) const {
+    const auto entry = find(challenge);
+    if ( !entry ) {
+        throw std::runtime_error{std::format("Challenge {:d} is not in the archive!", challenge)};
+    } //if ( !entry )
+    throwIfInvalid(entry->LineTableOffset <= Size &&
+                       entry->NumberOfLines <= (Size - entry->LineTableOffset) / sizeof(Line),
+                   "Truncated input archive");
+    throwIfInvalid(entry->ContentOffset <= Size && entry->ContentSize <= Size - entry->ContentOffset,
+                   "Truncated input archive");
+
+    const std::span lineTable{reinterpret_cast<const Line*>(Mapping + entry->LineTableOffset), entry->NumberOfLines};
+    const auto      base       = reinterpret_cast<const char*>(Mapping);
+    const auto      contentEnd = entry->ContentOffset + entry->ContentSize;
+
+    lines.clear();
+    lines.reserve(lineTable.size());
+    //Every line has to be within the content of its entry, otherwise the view would reach past the mapping.
+    std::ranges::transform(lineTable, std::back_inserter(lines), [base, entry, contentEnd](const Line& line) {
+        throwIfInvalid(line.Offset >= entry->ContentOffset && line.Offset <= contentEnd &&
+                           line.Length <= contentEnd - line.Offset,
+                       "Corrupt line table in input archive");
+        return std::string_view{base + line.Offset, line.Length};
+    });
+    return;
+}
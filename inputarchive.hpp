@@ -0,0 +1,57 @@
+#ifndef INPUTARCHIVE_HPP
+#define INPUTARCHIVE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+//Packs all N.txt of a data directory into one file, which is mapped once and serves the lines without any copy.
+//Layout: Header, Entry[NumberOfEntries], then per entry the content and its line table, each Alignment aligned.
+class InputArchive {
+    public:
+    static constexpr std::size_t Alignment = 64;
+
+    struct Header {
+        char          Magic[8];
+        std::uint32_t Version;
+        std::uint32_t NumberOfEntries;
+    };
+
+    struct Entry {
+        std::uint32_t Challenge;
+        std::uint32_t NumberOfLines;
+        std::uint64_t ContentOffset;
+        std::uint64_t ContentSize;
+        std::uint64_t LineTableOffset;
+    };
+
+    struct Line {
+        std::uint64_t Offset;
+        std::uint64_t Length;
+    };
+
+    explicit InputArchive(const std::filesystem::path& path);
+    ~InputArchive(void);
+
+    InputArchive(const InputArchive&)            = delete;
+    InputArchive& operator=(const InputArchive&) = delete;
+
+    static bool isArchive(const std::filesystem::path& path);
+    static void pack(const std::filesystem::path& dataDirectory, const std::filesystem::path& archivePath);
+
+    bool             contains(std::int64_t challenge) const noexcept;
+    std::string_view content(std::int64_t challenge) const;
+    void             fillLines(std::int64_t challenge, std::vector<std::string_view>& lines) const;
+
+    private:
+    const std::byte*       Mapping = nullptr;
+    std::size_t            Size    = 0;
+    std::span<const Entry> Entries;
+
+    const Entry* find(std::int64_t challenge) const noexcept;
+};
+
+#endif //INPUTARCHIVE_HPP
@@ -0,0 +1,354 @@
+#include "inputgenerators.hpp"
+
+#include "helper.hpp"
+
+#include <algorithm>
+#include <array>
+#include <format>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+namespace {
+using Engine = std::mt19937_64;
+
+std::int64_t randomBetween(Engine& engine, std::int64_t min, std::int64_t max) {
+    return std::uniform_int_distribution<std::int64_t>{min, max}(engine);
+}
+
+template<typename Range>
+decltype(auto) pick(Engine& engine, const Range& range) {
+    return range[static_cast<std::size_t>(randomBetween(engine, 0, std::ssize(range) - 1))];
+}
+
+//Walks the guard like day 6, every cell can be entered in 4 directions, so more steps than that mean a loop.
+bool guardLeaves(const std::vector<std::string>& map, std::size_t row, std::size_t column) noexcept {
+    std::int64_t rowStep    = -1;
+    std::int64_t columnStep = 0;
+    for ( std::size_t steps = 0; steps <= 4 * map.size() * map.front().size(); ++steps ) {
+        const auto nextRow    = static_cast<std::size_t>(static_cast<std::int64_t>(row) + rowStep);
+        const auto nextColumn = static_cast<std::size_t>(static_cast<std::int64_t>(column) + columnStep);
+        if ( nextRow >= map.size() || nextColumn >= map.front().size() ) {
+            return true;
+        } //if ( nextRow >= map.size() || nextColumn >= map.front().size() )
+
+        if ( map[nextRow][nextColumn] == '#' ) {
+            rowStep = std::exchange(columnStep, -rowStep);
+        } //if ( map[nextRow][nextColumn] == '#' )
+        else {
+            row    = nextRow;
+            column = nextColumn;
+        } //else -> if ( map[nextRow][nextColumn] == '#' )
+    } //for ( std::size_t steps = 0; steps <= 4 * map.size() * map.front().size(); ++steps )
+    return false;
+}
+} //namespace
+
+GeneratedInput::GeneratedInput(std::string content) : Content{std::make_unique<const std::string>(std::move(content))} {
+    std::ranges::copy(splitString<false>(*Content, '\n'), std::back_inserter(Lines));
+    while ( !Lines.empty() && Lines.back().empty() ) {
+        Lines.pop_back();
+    } //while ( !Lines.empty() && Lines.back().empty() )
+    return;
+}
+
+GeneratedInput generateLocationLists(std::size_t pairs, std::uint64_t seed) {
+    //The range grows with the number of pairs, so that there are always some duplicates.
+    const auto  maximum = 10'000 + static_cast<std::int64_t>(pairs);
+    Engine      engine{seed};
+    std::string content;
+    content.reserve(pairs * 14);
+    for ( std::size_t i = 0; i < pairs; ++i ) {
+        std::format_to(std::back_inserter(content), "{:d}   {:d}\n", randomBetween(engine, 10'000, maximum),
+                       randomBetween(engine, 10'000, maximum));
+    } //for ( std::size_t i = 0; i < pairs; ++i )
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateReports(std::size_t reports, std::uint64_t seed) {
+    Engine      engine{seed};
+    std::string content;
+    for ( std::size_t i = 0; i < reports; ++i ) {
+        const auto levels    = randomBetween(engine, 3, 9);
+        const auto direction = randomBetween(engine, 0, 1) ? 1 : -1;
+        auto       level     = randomBetween(engine, 10, 90);
+
+        for ( std::int64_t j = 0; j < levels; ++j ) {
+            std::format_to(std::back_inserter(content), "{:s}{:d}", j == 0 ? "" : " ", level);
+            //Mostly safe steps, with the occasional bad one.
+            const auto bad   = randomBetween(engine, 0, 9) == 0;
+            const auto step  = bad ? randomBetween(engine, -4, 5) : randomBetween(engine, 1, 3);
+            level           += direction * step;
+        } //for ( std::int64_t j = 0; j < levels; ++j )
+        content.push_back('\n');
+    } //for ( std::size_t i = 0; i < reports; ++i )
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateCorruptedMemory(std::size_t bytes, std::uint64_t seed) {
+    static constexpr std::array noise{"mul("sv,   "mul(1,"sv, "mul[3,4]"sv, "do("sv,    "don't"sv, ")"sv,     ","sv,
+                                      "what()"sv, "%&"sv,     "select"sv,   "mul ( "sv, "from()"sv, "who"sv,   "'"sv};
+    static constexpr auto lineLength = 4000zu;
+
+    Engine      engine{seed};
+    std::string content;
+    content.reserve(bytes + bytes / lineLength + 16);
+
+    for ( std::size_t lineStart = 0; content.size() < bytes; ) {
+        switch ( randomBetween(engine, 0, 9) ) {
+            case 0  : content.append("do()"); break;
+            case 1  : content.append("don't()"); break;
+            case 2  :
+            case 3  :
+            case 4  : {
+                std::format_to(std::back_inserter(content), "mul({:d},{:d})", randomBetween(engine, 1, 999),
+                               randomBetween(engine, 1, 999));
+                break;
+            } //case 2 - 4
+            default : content.append(pick(engine, noise)); break;
+        } //switch ( randomBetween(engine, 0, 9) )
+
+        if ( content.size() - lineStart >= lineLength ) {
+            content.push_back('\n');
+            lineStart = content.size();
+        } //if ( content.size() - lineStart >= lineLength )
+    } //for ( std::size_t lineStart = 0; content.size() < bytes; )
+    content.push_back('\n');
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateWordSearch(std::size_t rows, std::size_t columns, std::uint64_t seed) {
+    Engine      engine{seed};
+    std::string content;
+    content.reserve(rows * (columns + 1));
+    for ( std::size_t row = 0; row < rows; ++row ) {
+        std::ranges::generate_n(std::back_inserter(content), static_cast<std::ptrdiff_t>(columns),
+                                [&engine](void) { return pick(engine, "XMAS"sv); });
+        content.push_back('\n');
+    } //for ( std::size_t row = 0; row < rows; ++row )
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generatePrintQueue(std::size_t updates, std::uint64_t seed) {
+    Engine                    engine{seed};
+    std::string               content;
+    std::vector<std::int64_t> pages(49);
+    std::iota(pages.begin(), pages.end(), 11);
+    std::ranges::shuffle(pages, engine);
+
+    for ( std::size_t i = 0; i < pages.size(); ++i ) {
+        for ( std::size_t j = i + 1; j < pages.size(); ++j ) {
+            std::format_to(std::back_inserter(content), "{:d}|{:d}\n", pages[i], pages[j]);
+        } //for ( std::size_t j = i + 1; j < pages.size(); ++j )
+    } //for ( std::size_t i = 0; i < pages.size(); ++i )
+    content.push_back('\n');
+
+    std::vector<std::int64_t> update;
+    for ( std::size_t i = 0; i < updates; ++i ) {
+        //The sample keeps the order of the rules, every second update is then (most likely) brought out of order.
+        update.clear();
+        std::ranges::sample(pages, std::back_inserter(update), randomBetween(engine, 2, 11) * 2 + 1, engine);
+        if ( i % 2 == 1 ) {
+            std::ranges::shuffle(update, engine);
+        } //if ( i % 2 == 1 )
+
+        for ( std::size_t j = 0; j < update.size(); ++j ) {
+            std::format_to(std::back_inserter(content), "{:s}{:d}", j == 0 ? "" : ",", update[j]);
+        } //for ( std::size_t j = 0; j < update.size(); ++j )
+        content.push_back('\n');
+    } //for ( std::size_t i = 0; i < updates; ++i )
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generatePatrolMap(std::size_t rows, std::size_t columns, std::uint64_t seed) {
+    Engine engine{seed};
+    for ( ;; ) {
+        //About as dense as the real map.
+        std::vector<std::string> map(rows, std::string(columns, '.'));
+        for ( auto& row : map ) {
+            std::ranges::generate(row, [&engine](void) { return randomBetween(engine, 0, 19) == 0 ? '#' : '.'; });
+        } //for ( auto& row : map )
+
+        const auto row    = static_cast<std::size_t>(randomBetween(engine, 0, static_cast<std::int64_t>(rows) - 1));
+        const auto column = static_cast<std::size_t>(randomBetween(engine, 0, static_cast<std::int64_t>(columns) - 1));
+        map[row][column]  = '^';
+        if ( !guardLeaves(map, row, column) ) {
+            continue;
+        } //if ( !guardLeaves(map, row, column) )
+
+        std::string content;
+        content.reserve(rows * (columns + 1));
+        for ( const auto& line : map ) {
+            content.append(line).push_back('\n');
+        } //for ( const auto& line : map )
+        return GeneratedInput{std::move(content)};
+    } //for ( ;; )
+}
+
+GeneratedInput generateAntennaMap(std::size_t rows, std::size_t columns, std::size_t antennas, std::size_t frequencies,
+                                  std::uint64_t seed) {
+    static constexpr auto allFrequencies = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"sv;
+
+    Engine      engine{seed};
+    const auto  usedFrequencies = allFrequencies.substr(0, std::clamp(frequencies, 1zu, allFrequencies.size()));
+    std::string content;
+    for ( std::size_t row = 0; row < rows; ++row ) {
+        content.append(columns, '.').push_back('\n');
+    } //for ( std::size_t row = 0; row < rows; ++row )
+
+    for ( std::size_t i = 0; i < antennas; ++i ) {
+        const auto row    = static_cast<std::size_t>(randomBetween(engine, 0, static_cast<std::int64_t>(rows) - 1));
+        const auto column = static_cast<std::size_t>(randomBetween(engine, 0, static_cast<std::int64_t>(columns) - 1));
+        content[row * (columns + 1) + column] = pick(engine, usedFrequencies);
+    } //for ( std::size_t i = 0; i < antennas; ++i )
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateEquations(std::size_t equations, std::size_t operands, std::uint64_t seed) {
+    static constexpr std::int64_t maximumResult = 1'000'000'000'000'000;
+
+    Engine                    engine{seed};
+    std::string               content;
+    std::vector<std::int64_t> values(operands);
+
+    for ( std::size_t i = 0; i < equations; ++i ) {
+        //Sometimes a 0, the search backwards must not divide by it and the forward one must not prune before it.
+        std::ranges::generate(values, [&engine](void) {
+            return randomBetween(engine, 0, 19) == 0 ? 0 : randomBetween(engine, 1, 99);
+        });
+
+        //Build a valid result from random operators, without overflowing. Every second one is then made (most likely)
+        //invalid.
+        auto result = values.front();
+        for ( auto value : values | std::views::drop(1) ) {
+            const auto shift = value < 10 ? 10 : 100;
+            switch ( randomBetween(engine, 0, 2) ) {
+                case 0 : {
+                    if ( value == 0 || result <= maximumResult / value ) {
+                        result *= value;
+                        break;
+                    } //if ( value == 0 || result <= maximumResult / value )
+                    [[fallthrough]];
+                } //case 0
+                case 1 : {
+                    if ( result <= maximumResult / shift ) {
+                        result = result * shift + value;
+                        break;
+                    } //if ( result <= maximumResult / shift )
+                    [[fallthrough]];
+                } //case 1
+                default : result += value; break;
+            } //switch ( randomBetween(engine, 0, 2) )
+        } //for ( auto value : values | std::views::drop(1) )
+
+        if ( i % 2 == 1 ) {
+            ++result;
+        } //if ( i % 2 == 1 )
+
+        std::format_to(std::back_inserter(content), "{:d}:", result);
+        for ( auto value : values ) {
+            std::format_to(std::back_inserter(content), " {:d}", value);
+        } //for ( auto value : values )
+        content.push_back('\n');
+    } //for ( std::size_t i = 0; i < equations; ++i )
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateDiskMap(std::size_t digits, std::uint64_t seed) {
+    Engine      engine{seed};
+    std::string content;
+    //Always end with a file.
+    digits |= 1;
+    content.reserve(digits + 1);
+    for ( std::size_t i = 0; i < digits; ++i ) {
+        content.push_back(static_cast<char>('0' + randomBetween(engine, i % 2 == 0 ? 1 : 0, 9)));
+    } //for ( std::size_t i = 0; i < digits; ++i )
+    content.push_back('\n');
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateTopographicMap(std::size_t rows, std::size_t columns, std::size_t summits,
+                                      std::uint64_t seed) {
+    Engine engine{seed};
+    //The distance to the nearest summit, breadth first from all of them.
+    const auto               cells = rows * columns;
+    std::vector<std::size_t> distances(cells, cells);
+    std::vector<std::size_t> queue;
+    for ( std::size_t i = 0; i < summits && cells > 0; ++i ) {
+        const auto cell = static_cast<std::size_t>(randomBetween(engine, 0, static_cast<std::int64_t>(cells) - 1));
+        if ( distances[cell] != 0 ) {
+            distances[cell] = 0;
+            queue.push_back(cell);
+        } //if ( distances[cell] != 0 )
+    } //for ( std::size_t i = 0; i < summits && cells > 0; ++i )
+
+    for ( std::size_t index = 0; index < queue.size(); ++index ) {
+        const auto cell   = queue[index];
+        auto       update = [&distances, &queue, cell](std::size_t neighbor) {
+            if ( distances[neighbor] == distances.size() ) {
+                distances[neighbor] = distances[cell] + 1;
+                queue.push_back(neighbor);
+            } //if ( distances[neighbor] == distances.size() )
+            return;
+        };
+
+        if ( cell % columns > 0 ) {
+            update(cell - 1);
+        } //if ( cell % columns > 0 )
+        if ( cell % columns + 1 < columns ) {
+            update(cell + 1);
+        } //if ( cell % columns + 1 < columns )
+        if ( cell >= columns ) {
+            update(cell - columns);
+        } //if ( cell >= columns )
+        if ( cell + columns < cells ) {
+            update(cell + columns);
+        } //if ( cell + columns < cells )
+    } //for ( std::size_t index = 0; index < queue.size(); ++index )
+
+    std::string content;
+    content.reserve(rows * (columns + 1));
+    for ( std::size_t cell = 0; cell < cells; ++cell ) {
+        const auto height = randomBetween(engine, 0, 7) == 0 ? randomBetween(engine, 0, 9)
+                                                              : 9 - static_cast<std::int64_t>(distances[cell] % 10);
+        content.push_back(static_cast<char>('0' + height));
+        if ( cell % columns + 1 == columns ) {
+            content.push_back('\n');
+        } //if ( cell % columns + 1 == columns )
+    } //for ( std::size_t cell = 0; cell < cells; ++cell )
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateStones(std::size_t stones, std::uint64_t seed) {
+    Engine      engine{seed};
+    std::string content;
+    for ( std::size_t i = 0; i < stones; ++i ) {
+        std::format_to(std::back_inserter(content), "{:s}{:d}", i == 0 ? "" : " ",
+                       randomBetween(engine, 0, 9'999'999));
+    } //for ( std::size_t i = 0; i < stones; ++i )
+    content.push_back('\n');
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateSecrets(std::size_t secrets, std::uint64_t seed) {
+    Engine      engine{seed};
+    std::string content;
+    for ( std::size_t i = 0; i < secrets; ++i ) {
+        std::format_to(std::back_inserter(content), "{:d}\n", randomBetween(engine, 1, 16'777'215));
+    } //for ( std::size_t i = 0; i < secrets; ++i )
+    return GeneratedInput{std::move(content)};
+}
+
+GeneratedInput generateProgram(std::uint64_t seed) {
+    Engine engine{seed};
+    return GeneratedInput{std::format("Register A: {:d}\nRegister B: 0\nRegister C: 0\n\nProgram: "
+                                      "2,4,1,{:d},7,5,4,0,1,{:d},0,3,5,5,3,0\n",
+                                      randomBetween(engine, 1, 1 << 30), randomBetween(engine, 0, 7),
+                                      randomBetween(engine, 0, 7))};
+}
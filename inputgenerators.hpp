@@ -0,0 +1,51 @@
+#ifndef INPUTGENERATORS_HPP
+#define INPUTGENERATORS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//Synthetic, deterministic (for a given seed) inputs in the format of the challenges, but of arbitrary size.
+class GeneratedInput {
+    public:
+    explicit GeneratedInput(std::string content);
+
+    const std::vector<std::string_view>& lines(void) const noexcept {
+        return Lines;
+    }
+
+    std::string_view content(void) const noexcept {
+        return *Content;
+    }
+
+    private:
+    //Behind a pointer, so that the views stay valid when the input is moved.
+    std::unique_ptr<const std::string> Content;
+    std::vector<std::string_view>      Lines;
+};
+
+GeneratedInput generateLocationLists(std::size_t pairs, std::uint64_t seed = 1);
+GeneratedInput generateReports(std::size_t reports, std::uint64_t seed = 1);
+GeneratedInput generateCorruptedMemory(std::size_t bytes, std::uint64_t seed = 1);
+GeneratedInput generateWordSearch(std::size_t rows, std::size_t columns, std::uint64_t seed = 1);
+//A rule for every pair of 49 pages, so that every update has exactly one correct order.
+GeneratedInput generatePrintQueue(std::size_t updates, std::uint64_t seed = 1);
+//A map where the guard leaves, without the additional obstacle.
+GeneratedInput generatePatrolMap(std::size_t rows, std::size_t columns, std::uint64_t seed = 1);
+//Antennas of the first frequencies of "0-9A-Za-z" on random cells, later ones may replace earlier ones.
+GeneratedInput generateAntennaMap(std::size_t rows, std::size_t columns, std::size_t antennas, std::size_t frequencies,
+                                  std::uint64_t seed = 1);
+GeneratedInput generateEquations(std::size_t equations, std::size_t operands, std::uint64_t seed = 1);
+GeneratedInput generateDiskMap(std::size_t digits, std::uint64_t seed = 1);
+//Rings of falling heights around random summits, with some noise, so there are many trails which share segments.
+GeneratedInput generateTopographicMap(std::size_t rows, std::size_t columns, std::size_t summits,
+                                      std::uint64_t seed = 1);
+GeneratedInput generateStones(std::size_t stones, std::uint64_t seed = 1);
+GeneratedInput generateSecrets(std::size_t secrets, std::uint64_t seed = 1);
+//A day 17 program in the shape of the real one, so that it halts for every A.
+GeneratedInput generateProgram(std::uint64_t seed = 1);
+
+#endif //INPUTGENERATORS_HPP
@@ -0,0 +1,135 @@
+#include "linereader.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+LineReader::LineReader(const std::filesystem::path& path, std::size_t bufferSize) : Fd{::open(path.c_str(), O_RDONLY)} {
+    if ( Fd < 0 ) {
+        throw std::runtime_error{std::format("Could not open \"{:s}\"!", path.c_str())};
+    } //if ( Fd < 0 )
+
+    ::posix_fadvise(Fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    for ( auto& buffer : Buffers ) {
+        buffer.Data.resize(bufferSize);
+    } //for ( auto& buffer : Buffers )
+
+    Reader = std::jthread{[this](std::stop_token stop) noexcept { readAhead(stop); }};
+    return;
+}
+
+LineReader::~LineReader(void) {
+    Reader.request_stop();
+    for ( auto& buffer : Buffers ) {
+        buffer.Free.release();
+    } //for ( auto& buffer : Buffers )
+    Reader.join();
+    ::close(Fd);
+    return;
+}
+
+std::optional<std::string_view> LineReader::next(void) {
+    if ( CarryReturned ) {
+        Carry.clear();
+        CarryReturned = false;
+    } //if ( CarryReturned )
+
+    while ( true ) {
+        if ( const auto newLine = Remaining.find('\n'); newLine != std::string_view::npos ) {
+            const auto line = Remaining.substr(0, newLine);
+            Remaining.remove_prefix(newLine + 1);
+
+            if ( Carry.empty() ) {
+                return line;
+            } //if ( Carry.empty() )
+
+            Carry.append(line);
+            CarryReturned = true;
+            return std::string_view{Carry};
+        } //if ( const auto newLine = Remaining.find('\n'); newLine != std::string_view::npos )
+
+        //The line continues in the next buffer, which is about to be handed back to the reader.
+        Carry.append(Remaining);
+        Remaining = {};
+
+        if ( !fetchNextBuffer() ) {
+            if ( Carry.empty() ) {
+                return std::nullopt;
+            } //if ( Carry.empty() )
+
+            CarryReturned = true;
+            return std::string_view{Carry};
+        } //if ( !fetchNextBuffer() )
+    } //while ( true )
+}
+
+void LineReader::readAhead(std::stop_token stop) noexcept {
+    for ( std::size_t index = 0;; index ^= 1 ) {
+        auto& buffer = Buffers[index];
+        buffer.Free.acquire();
+
+        if ( stop.stop_requested() ) {
+            return;
+        } //if ( stop.stop_requested() )
+
+        std::size_t size = 0;
+        while ( size < buffer.Data.size() ) {
+            const auto result = ::read(Fd, buffer.Data.data() + size, buffer.Data.size() - size);
+
+            if ( result < 0 ) {
+                if ( errno == EINTR ) {
+                    continue;
+                } //if ( errno == EINTR )
+
+                Error = errno;
+                size  = 0;
+                break;
+            } //if ( result < 0 )
+
+            if ( result == 0 ) {
+                break;
+            } //if ( result == 0 )
+
+            size += static_cast<std::size_t>(result);
+        } //while ( size < buffer.Data.size() )
+
+        buffer.Size = size;
+        buffer.Filled.release();
+
+        if ( size == 0 ) {
+            return;
+        } //if ( size == 0 )
+    } //for ( std::size_t index = 0;; index ^= 1 )
+}
+
+bool LineReader::fetchNextBuffer(void) {
+    if ( EndOfFile ) {
+        return false;
+    } //if ( EndOfFile )
+
+    if ( Started ) {
+        Buffers[Current].Free.release();
+        Current ^= 1;
+    } //if ( Started )
+    Started = true;
+
+    auto& buffer = Buffers[Current];
+    buffer.Filled.acquire();
+
+    if ( Error != 0 ) {
+        throw std::runtime_error{std::format("Reading failed: {:s}", std::strerror(Error))};
+    } //if ( Error != 0 )
+
+    if ( buffer.Size == 0 ) {
+        EndOfFile = true;
+        return false;
+    } //if ( buffer.Size == 0 )
+
+    Remaining = {buffer.Data.data(), buffer.Size};
+    return true;
+}
@@ -0,0 +1,54 @@
+#ifndef LINEREADER_HPP
+#define LINEREADER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <semaphore>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+//Reads a file line by line in constant memory. A background thread fills one buffer with read() while the other one
+//is consumed, so I/O overlaps with the computation.
+class LineReader {
+    public:
+    static constexpr std::size_t DefaultBufferSize = 1 << 20;
+
+    explicit LineReader(const std::filesystem::path& path, std::size_t bufferSize = DefaultBufferSize);
+    ~LineReader(void);
+
+    LineReader(const LineReader&)            = delete;
+    LineReader& operator=(const LineReader&) = delete;
+
+    //The returned view is valid until the next call.
+    std::optional<std::string_view> next(void);
+
+    private:
+    struct Buffer {
+        std::vector<char>         Data;
+        std::size_t               Size = 0;
+        std::binary_semaphore     Filled{0};
+        std::counting_semaphore<> Free{1};
+    };
+
+    int                   Fd;
+    std::array<Buffer, 2> Buffers;
+    std::size_t           Current       = 0;
+    bool                  Started       = false;
+    bool                  EndOfFile     = false;
+    bool                  CarryReturned = false;
+    std::string_view      Remaining;
+    std::string           Carry;
+    std::atomic_int       Error{0};
+    std::jthread          Reader;
+
+    void readAhead(std::stop_token stop) noexcept;
+    bool fetchNextBuffer(void);
+};
+
+#endif //LINEREADER_HPP
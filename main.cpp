@@ -24,6 +24,8 @@
 #include "challenge8.hpp"
 #include "challenge9.hpp"
 #include "helper.hpp"
+#include "inputarchive.hpp"
+#include "linereader.hpp"
 #include "print.hpp"
 
 #include <algorithm>
@@ -34,6 +36,7 @@
 #include <format>
 #include <fstream>
 #include <iterator>
+#include <optional>
 #include <span>
 #include <string_view>
 #include <vector>
@@ -54,6 +57,22 @@ int main(int argc, const char* argv[]) {
         return -1;
     } //if ( argc < 3 )
 
+    if ( argv[1] == "--pack"sv ) {
+        if ( argc != 4 ) {
+            myErr("Usage: --pack <data directory> <archive>\n");
+            return -1;
+        } //if ( argc != 4 )
+
+        try {
+            InputArchive::pack(argv[2], argv[3]);
+        } //try
+        catch ( const std::exception& e ) {
+            myErr("Packing failed: {:s}\n", e.what());
+            return -3;
+        } //catch ( const std::exception& e )
+        return 0;
+    } //if ( argv[1] == "--pack"sv )
+
     const std::filesystem::path dataDirectory{argv[1]};
 
     if ( !std::filesystem::exists(dataDirectory) ) {
@@ -61,10 +80,28 @@ int main(int argc, const char* argv[]) {
         return -2;
     } //if ( !std::filesystem::exists(dataDirectory) )
 
+    //Instead of the directory a file created with --pack can be given, all inputs are then served from its mapping.
+    std::optional<InputArchive> archive;
+    if ( InputArchive::isArchive(dataDirectory) ) {
+        try {
+            archive.emplace(dataDirectory);
+        } //try
+        catch ( const std::exception& e ) {
+            myErr("{:s}\n", e.what());
+            return -2;
+        } //catch ( const std::exception& e )
+    } //if ( InputArchive::isArchive(dataDirectory) )
+
+    //With --stream the challenges which support it read their input line by line, instead of loading the whole file.
+    const bool streaming = argv[2] == "--stream"sv;
+    if ( streaming && archive ) {
+        myErr("--stream is ignored for an input archive.\n");
+    } //if ( streaming && archive )
+
     using Clock            = std::chrono::system_clock;
 
-    const std::span inputs = [&argc, &argv](void) noexcept {
-        std::span ret{argv + 2, argv + argc};
+    const std::span inputs = [&argc, &argv, streaming](void) noexcept {
+        std::span ret{argv + (streaming ? 3 : 2), argv + argc};
         if ( ret.size() == 1 && ret[0] == "0"sv ) {
             static std::array<const char*, 25> all{"1",  "2",  "3",  "4",  "5",  "6",  "7",  "8",  "9",
                                                    "10", "11", "12", "13", "14", "15", "16", "17", "18",
@@ -86,6 +123,17 @@ int main(int argc, const char* argv[]) {
         } //else -> if ( func(challengeInput ) )
         return;
     };
+    auto runStreamingAndAdd = [&challengesSuccesful](const std::filesystem::path& inputFilePath,
+                                                     bool (*func)(LineReader&)) {
+        LineReader reader{inputFilePath};
+        if ( func(reader) ) {
+            ++challengesSuccesful;
+        } //if ( func(reader) )
+        else {
+            myPrint("Failed\n");
+        } //else -> if ( func(reader) )
+        return;
+    };
 
     for ( const auto& input : inputs ) {
         const auto challenge = [](std::string_view text) noexcept -> std::int64_t {
@@ -102,35 +150,67 @@ int main(int argc, const char* argv[]) {
             continue;
         } //if ( challenge == 0 )
 
-        const auto inputFilePath = dataDirectory / std::format("{:d}.txt", challenge);
-
         try {
             ++challengesRun;
-            if ( !std::filesystem::exists(inputFilePath) ) {
-                throw std::runtime_error{std::format("\"{:s}\" does not exist!", inputFilePath.c_str())};
-            } //if ( !std::filesystem::exists(inputFilePath) )
-
-            if ( !std::filesystem::is_regular_file(inputFilePath) ) {
-                throw std::runtime_error{std::format("\"{:s}\" is not a file!", inputFilePath.c_str())};
-            } //if ( !std::filesystem::is_regular_file(inputFilePath) )
-
-            std::ifstream inputFile{inputFilePath};
-
-            if ( !inputFile ) {
-                throw std::runtime_error{std::format("Could not open \"{:s}\"!", inputFilePath.c_str())};
-            } //if ( !inputFile )
-
-            challengeInput.clear();
-            inputFile.seekg(0, std::ios::end);
-            const auto size = inputFile.tellg();
-            inputFile.seekg(0, std::ios::beg);
-            std::string fileContent(static_cast<std::size_t>(size), ' ');
-            inputFile.read(fileContent.data(), size);
-            std::ranges::copy(splitString<false>(fileContent, '\n'), std::back_inserter(challengeInput));
-            auto lastNonEmpty = std::ranges::find_last_if_not(challengeInput, &std::string_view::empty);
-            if ( lastNonEmpty.begin() != challengeInput.end() ) {
-                challengeInput.erase(std::next(lastNonEmpty.begin()), lastNonEmpty.end());
-            } //if ( lastNonEmpty.begin() != challengeInput.end() )
+            if ( streaming && !archive ) {
+                const auto inputFilePath = dataDirectory / std::format("{:d}.txt", challenge);
+                const auto streamingFunc = [challenge](void) noexcept -> bool (*)(LineReader&) {
+                    switch ( challenge ) {
+                        case 1  : return challenge1Streaming;
+                        case 2  : return challenge2Streaming;
+                        case 3  : return challenge3Streaming;
+                        case 7  : return challenge7Streaming;
+                        case 13 : return challenge13Streaming;
+                        case 14 : return challenge14Streaming;
+                        case 22 : return challenge22Streaming;
+                    } //switch ( challenge )
+                    return nullptr;
+                }();
+
+                if ( streamingFunc ) {
+                    myPrint(" == Starting Challenge {:d} (streaming) ==\n", challenge);
+                    const auto start = Clock::now();
+                    runStreamingAndAdd(inputFilePath, streamingFunc);
+                    const auto end = Clock::now();
+                    myPrint(" == End of Challenge {:d} after {} ==\n\n", challenge,
+                            std::chrono::duration_cast<std::chrono::milliseconds>(end - start));
+                    continue;
+                } //if ( streamingFunc )
+            } //if ( streaming && !archive )
+
+            std::string fileContent;
+            if ( archive ) {
+                archive->fillLines(challenge, challengeInput);
+            } //if ( archive )
+            else {
+                const auto inputFilePath = dataDirectory / std::format("{:d}.txt", challenge);
+
+                if ( !std::filesystem::exists(inputFilePath) ) {
+                    throw std::runtime_error{std::format("\"{:s}\" does not exist!", inputFilePath.c_str())};
+                } //if ( !std::filesystem::exists(inputFilePath) )
+
+                if ( !std::filesystem::is_regular_file(inputFilePath) ) {
+                    throw std::runtime_error{std::format("\"{:s}\" is not a file!", inputFilePath.c_str())};
+                } //if ( !std::filesystem::is_regular_file(inputFilePath) )
+
+                std::ifstream inputFile{inputFilePath};
+
+                if ( !inputFile ) {
+                    throw std::runtime_error{std::format("Could not open \"{:s}\"!", inputFilePath.c_str())};
+                } //if ( !inputFile )
+
+                challengeInput.clear();
+                inputFile.seekg(0, std::ios::end);
+                const auto size = inputFile.tellg();
+                inputFile.seekg(0, std::ios::beg);
+                fileContent.resize(static_cast<std::size_t>(size));
+                inputFile.read(fileContent.data(), size);
+                std::ranges::copy(splitString<false>(fileContent, '\n'), std::back_inserter(challengeInput));
+                auto lastNonEmpty = std::ranges::find_last_if_not(challengeInput, &std::string_view::empty);
+                if ( lastNonEmpty.begin() != challengeInput.end() ) {
+                    challengeInput.erase(std::next(lastNonEmpty.begin()), lastNonEmpty.end());
+                } //if ( lastNonEmpty.begin() != challengeInput.end() )
+            } //else -> if ( archive )
 
             myPrint(" == Starting Challenge {:d} ==\n", challenge);
             const auto start = Clock::now();
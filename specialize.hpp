@@ -0,0 +1,61 @@
+#ifndef SPECIALIZE_HPP
+#define SPECIALIZE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+//Calls specialized.template operator()<Candidate>() for the Candidate which equals value, or generic() if no one does.
+//This way a run-time property of the input (e.g. a count) selects a kernel, which was compiled with it as constant.
+template<auto Candidate, auto... Candidates, typename Value, typename Specialized, typename Generic>
+std::invoke_result_t<Generic&> dispatch(const Value value, Specialized&& specialized, Generic&& generic) {
+    if ( std::cmp_equal(value, Candidate) ) {
+        return specialized.template operator()<Candidate>();
+    } //if ( std::cmp_equal(value, Candidate) )
+
+    if constexpr ( sizeof...(Candidates) == 0 ) {
+        return generic();
+    } //if constexpr ( sizeof...(Candidates) == 0 )
+    else {
+        return dispatch<Candidates...>(value, std::forward<Specialized>(specialized), std::forward<Generic>(generic));
+    } //else -> if constexpr ( sizeof...(Candidates) == 0 )
+}
+
+//Builds {func.template operator()<0>(), ..., func.template operator()<N - 1>()}, e.g. a jump table of specializations.
+template<std::size_t N, typename Func>
+constexpr auto makeDispatchTable(Func&& func) noexcept {
+    return [&func]<std::size_t... Indices>(std::index_sequence<Indices...>) noexcept {
+        return std::array{func.template operator()<Indices>()...};
+    }(std::make_index_sequence<N>{});
+}
+
+//A string usable as template argument, so that the needle of a search is known to the compiler.
+template<std::size_t N>
+struct FixedString {
+    char Data[N]{};
+
+    constexpr FixedString(const char (&text)[N + 1]) noexcept {
+        std::ranges::copy_n(text, N, Data);
+        return;
+    }
+
+    static constexpr std::size_t size(void) noexcept {
+        return N;
+    }
+
+    constexpr char operator[](std::size_t index) const noexcept {
+        return Data[index];
+    }
+
+    constexpr std::string_view view(void) const noexcept {
+        return {Data, N};
+    }
+};
+
+template<std::size_t N>
+FixedString(const char (&)[N]) -> FixedString<N - 1>;
+
+#endif //SPECIALIZE_HPP